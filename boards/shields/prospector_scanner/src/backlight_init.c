@@ -12,6 +12,8 @@
 #include <zephyr/drivers/display.h>
 #include <zephyr/logging/log.h>
 
+#include "boot_timing.h"
+
 LOG_MODULE_REGISTER(backlight_init, LOG_LEVEL_INF);
 
 /* Backlight PWM LED node */
@@ -67,6 +69,7 @@ static int backlight_init(void) {
         return ret;
     }
 
+    boot_timing_mark(BOOT_PHASE_BACKLIGHT_ON);
     LOG_INF("Backlight turned ON at %d%% brightness", DEFAULT_BRIGHTNESS);
 
     /* Start heartbeat timer - every 3 seconds */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Battery runtime estimator (see battery_estimator.h)
+ *
+ * Keyboards report whole percentages, so a level is constant for hours and
+ * then steps down by 1%. Sampling on every reception would weight the fit
+ * by how long each step lasted; instead only the step edges are recorded:
+ * the first time a level lower than any seen since the last charge appears.
+ * Small upward jitter (+1%) is ignored; a rise of 2% or more above the
+ * lowest level since the last charge, or the central's charging/USB flag,
+ * is treated as a charge. Comparing against that minimum rather than the
+ * previous report also catches slow charging that climbs 1% at a time.
+ * The history restarts from the first step down once discharge resumes.
+ *
+ * Memory is fixed (WINDOW points per battery) and the fit only runs when a
+ * new edge is recorded, so the per-packet cost is a few compares.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include "battery_estimator.h"
+#include "scanner_stub.h"
+
+LOG_MODULE_REGISTER(battery_estimator, LOG_LEVEL_INF);
+
+#define EST_WINDOW       CONFIG_PROSPECTOR_BATTERY_ESTIMATOR_WINDOW
+#define EST_MIN_POINTS   3     /* At least 2% of discharge observed */
+#define EST_CHARGE_RISE  2     /* Rise that counts as charging, not jitter */
+#define EST_MAX_HOURS    (999 * 24)
+
+struct battery_est {
+    uint8_t last_level;        /* Last reported level (0 = not seen) */
+    uint8_t min_level;         /* Lowest level since the last charge (latest while charging) */
+    bool charging;
+    uint8_t count;             /* Valid points in the window */
+    uint8_t head;              /* Next write position */
+    uint32_t t_s[EST_WINDOW];  /* Step edge time (uptime seconds) */
+    uint8_t level[EST_WINDOW];
+    uint16_t hours_left;       /* Cached result, 0 = unknown */
+};
+
+static struct battery_est estimators[SCANNER_STUB_MAX_KEYBOARDS][BATTERY_EST_DEVICES];
+static uint32_t slot_keyboard_id[SCANNER_STUB_MAX_KEYBOARDS];
+static struct k_spinlock est_lock;
+
+static void est_clear_window(struct battery_est *est) {
+    est->count = 0;
+    est->head = 0;
+    est->hours_left = 0;
+}
+
+/*
+ * Least-squares fit of level over time, in integer arithmetic.
+ * x is seconds relative to the oldest point so the sums stay small:
+ * 16 points over a few weeks keep n*Sxx well inside int64.
+ */
+static uint16_t est_fit_hours(const struct battery_est *est) {
+    int first = (est->head + EST_WINDOW - est->count) % EST_WINDOW;
+    uint32_t t0 = est->t_s[first];
+    int64_t n = est->count;
+    int64_t sx = 0, sy = 0, sxx = 0, sxy = 0;
+
+    for (int i = 0; i < est->count; i++) {
+        int idx = (first + i) % EST_WINDOW;
+        int64_t x = (int64_t)(est->t_s[idx] - t0);
+        int64_t y = est->level[idx];
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+
+    int64_t den = n * sxx - sx * sx;       /* > 0 when times differ */
+    int64_t num = n * sxy - sx * sy;       /* < 0 when discharging */
+    if (den <= 0 || num >= 0) {
+        return 0;
+    }
+
+    /* remaining = level / -slope = level * den / -num (seconds) */
+    int newest = (est->head + EST_WINDOW - 1) % EST_WINDOW;
+    int64_t secs_left = (int64_t)est->level[newest] * den / -num;
+    int64_t hours = secs_left / 3600;
+
+    if (hours < 1) {
+        hours = 1;
+    }
+    return (uint16_t)MIN(hours, EST_MAX_HOURS);
+}
+
+static void est_update(struct battery_est *est, uint8_t level, bool charge_flag, uint32_t now_s) {
+    if (level == 0 || level > 100) {
+        /* 0 = peripheral not connected; keep history for when it returns */
+        return;
+    }
+    if (level == est->last_level && charge_flag == est->charging) {
+        return;  /* Common case: nothing changed */
+    }
+
+    bool first = (est->last_level == 0);
+    bool rising = !first && level >= est->min_level + EST_CHARGE_RISE;
+    bool still_charging = est->charging && level > est->min_level;
+    est->last_level = level;
+
+    if (charge_flag || rising || still_charging) {
+        if (!est->charging) {
+            LOG_DBG("Charging detected at %u%%", level);
+        }
+        est->charging = true;
+        est->min_level = level;
+        est_clear_window(est);
+        return;
+    }
+
+    if (est->charging || first) {
+        /* Discharge (re)starts here; this level's edge time is unknown */
+        est->charging = false;
+        est->min_level = level;
+        est_clear_window(est);
+        return;
+    }
+
+    if (level >= est->min_level) {
+        return;  /* Jitter back up, or still on the same step */
+    }
+
+    /* New step edge */
+    est->min_level = level;
+    est->t_s[est->head] = now_s;
+    est->level[est->head] = level;
+    est->head = (est->head + 1) % EST_WINDOW;
+    if (est->count < EST_WINDOW) {
+        est->count++;
+    }
+
+    if (est->count >= EST_MIN_POINTS) {
+        est->hours_left = est_fit_hours(est);
+    }
+}
+
+void battery_estimator_update(int slot, const struct zmk_status_adv_data *data) {
+    if (slot < 0 || slot >= SCANNER_STUB_MAX_KEYBOARDS) {
+        return;
+    }
+
+    const uint8_t levels[BATTERY_EST_DEVICES] = {
+        data->battery_level,
+        data->peripheral_battery[0],
+        data->peripheral_battery[1],
+        data->peripheral_battery[2],
+    };
+    /* Only the central reports its charging state */
+    bool central_charging =
+        (data->status_flags & (ZMK_STATUS_FLAG_CHARGING | ZMK_STATUS_FLAG_USB_CONNECTED)) != 0;
+    uint32_t now_s = (uint32_t)(k_uptime_get() / 1000);
+
+    uint32_t keyboard_id = sys_get_be32(data->keyboard_id);
+
+    k_spinlock_key_t key = k_spin_lock(&est_lock);
+    if (keyboard_id != slot_keyboard_id[slot]) {
+        /* Slot now holds another keyboard - its history does not apply */
+        memset(estimators[slot], 0, sizeof(estimators[slot]));
+        slot_keyboard_id[slot] = keyboard_id;
+    }
+    for (int i = 0; i < BATTERY_EST_DEVICES; i++) {
+        est_update(&estimators[slot][i], levels[i], i == 0 && central_charging, now_s);
+    }
+    k_spin_unlock(&est_lock, key);
+}
+
+uint16_t battery_estimator_get_hours(int slot, int device) {
+    if (slot < 0 || slot >= SCANNER_STUB_MAX_KEYBOARDS ||
+        device < 0 || device >= BATTERY_EST_DEVICES) {
+        return 0;
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&est_lock);
+    uint16_t hours = estimators[slot][device].charging ? 0 : estimators[slot][device].hours_left;
+    k_spin_unlock(&est_lock, key);
+
+    return hours;
+}
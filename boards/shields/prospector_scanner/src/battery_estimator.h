@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Battery runtime estimator for received keyboards
+ *
+ * One estimator per battery (central + 3 peripherals) per keyboard slot.
+ * Each keeps the last CONFIG_PROSPECTOR_BATTERY_ESTIMATOR_WINDOW discharge
+ * step edges (time at which a new lower percentage was first seen) and
+ * fits a least-squares slope over them in integer arithmetic.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zmk/status_advertisement.h>
+
+#define BATTERY_EST_DEVICES 4  /* battery_level + peripheral_battery[3] */
+
+/**
+ * @brief Feed the battery levels of one received advertisement
+ *
+ * Cheap when nothing changed (compare only) - call on every reception.
+ * History survives keyboard sleep/timeout and is only dropped when a
+ * different keyboard_id shows up in the slot.
+ */
+void battery_estimator_update(int slot, const struct zmk_status_adv_data *data);
+
+/**
+ * @brief Estimated remaining runtime
+ *
+ * @return hours left (>= 1), or 0 if unknown (not enough history or charging)
+ */
+uint16_t battery_estimator_get_hours(int slot, int device);
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Boot-phase timestamps (see boot_timing.h)
+ *
+ * Marks are stored in microseconds of uptime and never logged as they
+ * happen - logging during boot is what we are trying to keep off the
+ * critical path. "prospector boot" prints them with the delta to the
+ * previous recorded phase.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include "boot_timing.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+static ATOMIC_DEFINE(phase_recorded, BOOT_PHASE_COUNT);
+static uint32_t phase_us[BOOT_PHASE_COUNT];
+
+void boot_timing_mark(enum boot_phase phase) {
+    if (phase >= BOOT_PHASE_COUNT || atomic_test_and_set_bit(phase_recorded, phase)) {
+        return;
+    }
+    phase_us[phase] = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static const char *const phase_names[BOOT_PHASE_COUNT] = {
+    [BOOT_PHASE_BACKLIGHT_ON] = "backlight on",
+    [BOOT_PHASE_SETTINGS_LOADED] = "settings loaded",
+    [BOOT_PHASE_SENSOR_READY] = "light sensor ready",
+    [BOOT_PHASE_SCREEN_CREATE] = "screen create",
+    [BOOT_PHASE_FIRST_FRAME] = "first frame",
+    [BOOT_PHASE_UI_COMPLETE] = "ui complete",
+    [BOOT_PHASE_SCAN_START] = "scan start",
+    [BOOT_PHASE_FIRST_PACKET] = "first packet",
+    [BOOT_PHASE_FIRST_KEYBOARD] = "first keyboard",
+};
+
+static int cmd_boot(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    uint32_t prev_us = 0;
+
+    shell_print(sh, "%-20s %10s %10s", "phase", "at (ms)", "+ (ms)");
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        if (!atomic_test_bit(phase_recorded, i)) {
+            shell_print(sh, "%-20s %10s", phase_names[i], "-");
+            continue;
+        }
+        uint32_t us = phase_us[i];
+        /* Phases overlap (scan vs UI), so the delta can be negative */
+        int32_t delta_ms = (int32_t)(us / 1000) - (int32_t)(prev_us / 1000);
+        shell_print(sh, "%-20s %6u.%03u %+10d", phase_names[i], us / 1000, us % 1000, delta_ms);
+        prev_us = us;
+    }
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), boot, NULL, "Boot phase timestamps", cmd_boot, 1, 0);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
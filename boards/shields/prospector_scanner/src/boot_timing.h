@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Boot-phase timestamps, shown on demand with "prospector boot"
+ */
+
+#pragma once
+
+#include <zephyr/sys/util.h>
+
+enum boot_phase {
+    BOOT_PHASE_BACKLIGHT_ON,     /* PWM backlight set (SYS_INIT 50) */
+    BOOT_PHASE_SETTINGS_LOADED,  /* Stored display settings applied to RAM */
+    BOOT_PHASE_SENSOR_READY,     /* Ambient light sensor initialized */
+    BOOT_PHASE_SCREEN_CREATE,    /* zmk_display_status_screen() entered */
+    BOOT_PHASE_FIRST_FRAME,      /* Minimal main screen flushed to the panel */
+    BOOT_PHASE_UI_COMPLETE,      /* Deferred main screen widgets built */
+    BOOT_PHASE_SCAN_START,       /* BLE scanning running */
+    BOOT_PHASE_FIRST_PACKET,     /* First Prospector advertisement received */
+    BOOT_PHASE_FIRST_KEYBOARD,   /* First keyboard data on screen */
+    BOOT_PHASE_COUNT,
+};
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_BOOT_TIMING)
+
+/**
+ * @brief Record the uptime of a boot phase
+ *
+ * Only the first call per phase is kept, so it is cheap and safe to call
+ * from recurring paths (packet callback, LVGL timer) and from any thread.
+ */
+void boot_timing_mark(enum boot_phase phase);
+
+#else
+
+static inline void boot_timing_mark(enum boot_phase phase) {
+    ARG_UNUSED(phase);
+}
+
+#endif
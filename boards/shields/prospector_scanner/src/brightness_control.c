@@ -17,6 +17,8 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include "brightness_control.h"
+#include "boot_timing.h"
+#include "ui_wake.h"
 
 // Auto brightness configuration defaults
 #ifndef CONFIG_PROSPECTOR_ALS_MIN_BRIGHTNESS
@@ -69,6 +71,8 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 // Default ADC integration time (219 = ~103ms)
 #define APDS9960_DEFAULT_ATIME  219
+/* One ALS integration cycle (2.78ms per step) - first valid reading */
+#define APDS9960_ALS_INTEGRATION_MS (((256 - APDS9960_DEFAULT_ATIME) * 278 + 99) / 100)
 
 // Sensor state
 static const struct device *i2c_dev = NULL;
@@ -224,6 +228,11 @@ static void brightness_sensor_work_handler(struct k_work *work) {
     // Main thread will do I2C access safely
     scanner_msg_send_brightness_sensor_read();
 
+    // Wake the LVGL auto brightness timer to take the sample now
+    if (auto_brightness_enabled) {
+        ui_wake(UI_WAKE_BRIGHTNESS);
+    }
+
 reschedule:
     k_work_schedule(&brightness_sensor_work, K_MSEC(CONFIG_PROSPECTOR_ALS_UPDATE_INTERVAL_MS));
 }
@@ -270,6 +279,7 @@ static int brightness_control_init(void) {
     }
 
     sensor_available = true;
+    boot_timing_mark(BOOT_PHASE_SENSOR_READY);
 
     LOG_INF("✅ Sensor brightness control ready (message queue mode)");
     LOG_INF("📊 Settings: Min=%u%%, Max=%u%%, Threshold=%u, Interval=%ums",
@@ -281,8 +291,8 @@ static int brightness_control_init(void) {
     // Initialize work queue
     k_work_init_delayable(&brightness_sensor_work, brightness_sensor_work_handler);
 
-    // Start sensor monitoring after 1 second
-    k_work_schedule(&brightness_sensor_work, K_MSEC(1000));
+    // First read as soon as one integration cycle has completed
+    k_work_schedule(&brightness_sensor_work, K_MSEC(APDS9960_ALS_INTEGRATION_MS));
 
     return 0;
 }
@@ -34,6 +34,28 @@
 #include "fonts.h"  /* NerdFont declarations */
 #include "touch_handler.h"  /* For LVGL input device registration */
 #include "brightness_control.h"  /* For auto brightness sensor control */
+#include "boot_timing.h"
+#include "ui_bind.h"  /* Diff-aware widget setters */
+#include "ui_wake.h"  /* Event-driven timer wakeups */
+#include "display_sched.h"  /* Tickless LVGL scheduling */
+#include "frame_stats.h"
+#include "flush_opt.h"  /* Dirty-rectangle merging */
+#include "display_sleep.h"  /* Deep screen-off without keyboards */
+#include "panel_idle.h"  /* Dim states and panel idle mode */
+#include "render_bench.h"  /* Render buffer benchmark matrix */
+#include "perf_overlay.h"  /* Pipeline statistics overlay */
+#if IS_ENABLED(CONFIG_PROSPECTOR_DIGIT_ATLAS)
+#include "digit_readout.h"
+#endif
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+#include <lvgl_mem.h>  /* Screen cache cost accounting */
+#endif
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+#if IS_ENABLED(CONFIG_PROSPECTOR_SETTINGS_STORE)
+#include "display_settings_store.h"
+#endif
 
 LOG_MODULE_REGISTER(display_screen, LOG_LEVEL_INF);
 
@@ -53,6 +75,8 @@ struct pending_display_data {
     int profile;
     uint8_t modifiers;
     int bat[4];
+    uint16_t bat_hours[4];                /* Estimated runtime, 0 = unknown */
+    bool stale;                           /* Last-known state restored at boot */
     int8_t rssi;
     float rate_hz;
     int scanner_battery;
@@ -68,6 +92,7 @@ extern bool scanner_get_pending_battery(int *level);
 
 /* LVGL timer for processing pending updates in main thread */
 static lv_timer_t *pending_update_timer = NULL;
+static lv_timer_t *main_deferred_timer = NULL;  /* Builds non-essential widgets after first frame */
 
 /* ========== Screen State Management ========== */
 enum screen_state {
@@ -76,10 +101,29 @@ enum screen_state {
     SCREEN_SYSTEM_SETTINGS,
     SCREEN_KEYBOARD_SELECT,
     SCREEN_PONG_WARS,
+    SCREEN_COUNT,
 };
 
 static enum screen_state current_screen = SCREEN_MAIN;
-static lv_obj_t *screen_obj = NULL;
+static lv_obj_t *screen_obj = NULL;  /* Container of the current screen - parent for its widgets */
+static lv_obj_t *root_screen = NULL;  /* LVGL screen holding all screen containers */
+static lv_obj_t *screen_containers[SCREEN_COUNT];
+/* Layer layout the main screen was built with - rebuilt when changed */
+static bool main_built_slide_mode;
+static uint8_t main_built_max_layers;  /* Layer count main was built for, 0 = not built */
+
+/* Full-screen container for one screen, positioned like the root screen
+ * so widget coordinates are unchanged */
+static lv_obj_t *screen_container_create(enum screen_state screen, uint32_t bg_color) {
+    lv_obj_t *cont = lv_obj_create(root_screen);
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_color(cont, lv_color_hex(bg_color), 0);
+    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+    screen_containers[screen] = cont;
+    return cont;
+}
 
 /* Transition protection flag - checked by work queues */
 volatile bool transition_in_progress = false;
@@ -107,6 +151,7 @@ static void create_keyboard_select_widgets(void);
 static void destroy_pong_wars_widgets(void);
 static void create_pong_wars_widgets(void);
 static void swipe_process_timer_cb(lv_timer_t *timer);
+static void render_bench_scenes_register(void);
 
 /* Display update functions - called from pending_update_timer_cb */
 void display_update_device_name(const char *name);
@@ -116,6 +161,8 @@ void display_update_connection(bool usb_rdy, bool ble_conn, bool ble_bond, int p
 void display_update_modifiers(uint8_t mods);
 void display_update_keyboard_battery_4(int bat0, int bat1, int bat2, int bat3);
 void display_update_scanner_battery(int level);
+void display_update_signal(int8_t rssi_val, float rate);
+void display_update_signal_x100(int8_t rssi_val, int32_t rate_x100_val);
 
 /* Custom slider state for inverted drag handling */
 /* Due to 180° touch panel rotation, LVGL X decreases when user drags right */
@@ -166,14 +213,16 @@ static int wpm_value = 0;
 #define MAX_KB_BATTERIES 4
 static int battery_values[MAX_KB_BATTERIES] = {0, 0, 0, 0};  /* Up to 4 keyboard batteries */
 static int active_battery_count = 0;  /* How many batteries are active (>0) */
+static uint16_t battery_hours[MAX_KB_BATTERIES] = {0};  /* Runtime estimate, 0 = unknown */
 static int scanner_battery = 0;
 static int8_t rssi = -100;  /* Default: very weak signal */
-static float rate_hz = -1.0f;  /* Negative = not yet received, will show as "-.--Hz" */
+static int32_t rate_x100 = -100;  /* Rate * 100; negative = not yet received, shows "-.--Hz" */
 static int ble_profile = 0;
 static bool usb_ready = false;
 static bool ble_connected = false;
 static bool ble_bonded = false;
 static char cached_device_name[32] = "Scanning...";
+static bool cached_device_stale = false;  /* Restored at boot, not heard yet (grey name) */
 static uint8_t cached_modifiers = 0;
 
 /* ========== PWM Backlight Control ========== */
@@ -184,6 +233,8 @@ static const struct device *backlight_dev = DEVICE_DT_GET(BACKLIGHT_NODE);
 static const struct device *backlight_dev = NULL;
 #endif
 
+static uint8_t backlight_level = 100;  /* Last level set, restored after deep sleep */
+
 static void set_pwm_brightness(uint8_t brightness) {
     if (!backlight_dev || !device_is_ready(backlight_dev)) {
         LOG_WRN("Backlight device not ready");
@@ -193,6 +244,10 @@ static void set_pwm_brightness(uint8_t brightness) {
     if (brightness < 1) {
         brightness = 1;
     }
+    backlight_level = brightness;
+    if (display_sleep_is_asleep()) {
+        return;  /* Applied on wake (auto brightness keeps running) */
+    }
     /* INVERT: Backlight circuit is inverted (100% PWM = dark, 0% = bright)
      * So we invert: user's 100% brightness → 0% PWM duty, 1% brightness → 99% PWM */
     uint8_t pwm_value = 100 - brightness;
@@ -204,6 +259,18 @@ static void set_pwm_brightness(uint8_t brightness) {
     }
 }
 
+/* Deep sleep turns the backlight fully off (below the 1% floor above) */
+static void display_sleep_backlight(bool asleep) {
+    if (!backlight_dev || !device_is_ready(backlight_dev)) {
+        return;
+    }
+    if (asleep) {
+        led_set_brightness(backlight_dev, 0, 100);  /* Inverted: 100% PWM = dark */
+    } else {
+        set_pwm_brightness(backlight_level);
+    }
+}
+
 /* ========== Widget references (NO CONTAINERS) ========== */
 
 /* Device name */
@@ -286,6 +353,50 @@ static uint8_t ds_max_layers = 7;
 static bool ds_layer_slide_mode = IS_ENABLED(CONFIG_PROSPECTOR_LAYER_SLIDE_DEFAULT);  /* Slide animation mode for layer display */
 static uint8_t ds_layer_slide_max = 7;    /* Dynamic max layer for slide mode */
 
+/* Hand the current Display Settings to the store (write-behind, coalesced) */
+static void ds_settings_changed(void) {
+#if IS_ENABLED(CONFIG_PROSPECTOR_SETTINGS_STORE)
+    struct display_settings settings = {
+        .auto_brightness = ds_auto_brightness_enabled,
+        .manual_brightness = ds_manual_brightness,
+        .battery_visible = ds_battery_visible,
+        .max_layers = ds_max_layers,
+        .layer_slide_mode = ds_layer_slide_mode,
+    };
+    display_settings_store_save(&settings);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SETTINGS_STORE)
+static void auto_brightness_timer_cb(lv_timer_t *timer);
+
+/* Apply stored Display Settings - called before the main screen widgets exist */
+static void ds_settings_restore(void) {
+    struct display_settings settings;
+    if (!display_settings_store_get(&settings)) {
+        return;
+    }
+
+    ds_auto_brightness_enabled = settings.auto_brightness;
+    ds_manual_brightness = CLAMP(settings.manual_brightness, 1, 100);
+    ds_battery_visible = settings.battery_visible;
+    ds_max_layers = CLAMP(settings.max_layers, 4, 10);
+    ds_layer_slide_mode = settings.layer_slide_mode;
+
+    brightness_control_set_auto(ds_auto_brightness_enabled);
+    if (ds_auto_brightness_enabled && brightness_control_sensor_available()) {
+        auto_brightness_timer = lv_timer_create(auto_brightness_timer_cb, AUTO_BRIGHTNESS_INTERVAL_MS, NULL);
+        ui_wake_bind(UI_WAKE_BRIGHTNESS, auto_brightness_timer, AUTO_BRIGHTNESS_INTERVAL_MS);
+    } else {
+        set_pwm_brightness(ds_manual_brightness);
+    }
+
+    LOG_INF("Display settings restored: auto=%d bright=%d%% battery=%d layers=%d slide=%d",
+            ds_auto_brightness_enabled, ds_manual_brightness, ds_battery_visible,
+            ds_max_layers, ds_layer_slide_mode);
+}
+#endif
+
 /* Forward declarations for layer display helpers */
 static void create_layer_list_widgets(lv_obj_t *parent, int y_offset);
 static void destroy_layer_list_widgets(void);
@@ -309,6 +420,8 @@ static lv_obj_t *ss_version_label = NULL;
 static lv_obj_t *ss_bootloader_btn = NULL;
 static lv_obj_t *ss_reset_btn = NULL;
 static lv_obj_t *ss_nav_hint = NULL;
+static lv_obj_t *ss_perf_btn = NULL;    /* Stats overlay toggle (CONFIG_PROSPECTOR_PERF_OVERLAY) */
+static lv_obj_t *ss_perf_label = NULL;
 
 /* ========== Keyboard Select Screen Widgets (NO CONTAINER) ========== */
 #define KS_MAX_KEYBOARDS 6  /* Maximum displayable keyboards */
@@ -316,6 +429,9 @@ static lv_obj_t *ks_title_label = NULL;
 static lv_obj_t *ks_nav_hint = NULL;
 static lv_timer_t *ks_update_timer = NULL;
 static int ks_selected_keyboard = -1;  /* Currently selected keyboard index */
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+static uint32_t ks_follow_switches = 0;  /* Auto-follow switches already shown */
+#endif
 
 /* Per-keyboard entry widgets */
 struct ks_keyboard_entry {
@@ -337,10 +453,9 @@ static lv_obj_t *ks_channel_value = NULL;
 static lv_obj_t *ks_channel_popup = NULL;
 static lv_obj_t *ks_channel_popup_btns[11] = {NULL};  /* 0-9 + All(10) */
 
-/* Runtime channel (defined in system_settings_widget.c, fallback here) */
-/* Default to CHANNEL_ALL (10) = show all keyboards */
-static uint8_t ks_runtime_channel = 10;  /* CHANNEL_ALL */
-static bool ks_channel_initialized = false;
+/* Runtime channel - system_settings_widget.c (always built with this screen) */
+uint8_t scanner_get_runtime_channel(void);
+void scanner_set_runtime_channel(uint8_t channel);
 
 /* Channel color palette (pastel colors for good visibility) */
 static lv_color_t get_channel_color(uint8_t channel) {
@@ -358,21 +473,6 @@ static lv_color_t get_channel_color(uint8_t channel) {
     }
 }
 
-/* Channel functions - try to use system_settings_widget.c version if available */
-__attribute__((weak)) uint8_t scanner_get_runtime_channel(void) {
-    if (!ks_channel_initialized) {
-        ks_runtime_channel = 10;  /* Default: All (CHANNEL_ALL=10) */
-        ks_channel_initialized = true;
-    }
-    return ks_runtime_channel;
-}
-
-__attribute__((weak)) void scanner_set_runtime_channel(uint8_t channel) {
-    ks_runtime_channel = channel;
-    ks_channel_initialized = true;
-    LOG_INF("Channel set to %d", channel);
-}
-
 /* ========== Color functions ========== */
 
 static lv_color_t get_layer_color(int layer) {
@@ -468,43 +568,85 @@ static lv_color_t get_rssi_color(uint8_t bars) {
     }
 }
 
+/* Dim levels apply over the current level; auto brightness keeps control.
+ * A level set while dimmed (slider, timeout brightness) wins over the
+ * remembered one. */
+static uint8_t pre_dim_level;
+static uint8_t dim_applied_level;  /* Level this hook set last */
+
+static void panel_dim_backlight(bool dimmed, uint8_t brightness) {
+    if (ds_auto_brightness_enabled && brightness_control_sensor_available()) {
+        return;
+    }
+    bool changed = pre_dim_level && backlight_level != dim_applied_level;
+    if (dimmed) {
+        if (!pre_dim_level || changed) {
+            pre_dim_level = backlight_level;
+        }
+        set_pwm_brightness(MIN(brightness, pre_dim_level));
+        dim_applied_level = backlight_level;
+    } else if (pre_dim_level) {
+        if (!changed) {
+            set_pwm_brightness(pre_dim_level);
+        }
+        pre_dim_level = 0;
+    }
+}
+
 /* ========== Pending Update Timer Callback (runs in main thread) ========== */
 static char last_keyboard_name[MAX_NAME_LEN] = "";  /* Track keyboard changes */
+static int last_update_layer = -1;  /* Layer changes count as activity for dimming */
 
 static void pending_update_timer_cb(lv_timer_t *timer) {
     ARG_UNUSED(timer);
 
     /* Only process updates on main screen */
     if (current_screen != SCREEN_MAIN) {
+        ui_wake_count_run(UI_WAKE_DISPLAY, true);
         return;
     }
 
+    bool idle = true;
+
     /* Check for pending display update */
     struct pending_display_data data;
     if (scanner_get_pending_update(&data)) {
+        idle = false;
         /* Check if all keyboards have timed out */
         if (data.no_keyboards) {
             LOG_INF("All keyboards timed out - returning to Scanning... state");
 
             /* Reset display to initial "Scanning..." state */
+            cached_device_stale = false;
             display_update_device_name("Scanning...");
             display_update_layer(0);
             display_update_wpm(0);
             display_update_connection(false, false, false, 0);
             display_update_modifiers(0);
+            memset(battery_hours, 0, sizeof(battery_hours));
             display_update_keyboard_battery_4(0, 0, 0, 0);
 
             /* Clear last keyboard name so next keyboard triggers battery reposition */
             last_keyboard_name[0] = '\0';
             active_battery_count = -1;
 
-            /* Apply timeout brightness if configured */
+            /* Leave any dim state before the timeout handling below */
+            panel_idle_note_keyboard(false, false);
+            last_update_layer = -1;
+
+            /* Deep screen-off, or apply timeout brightness if configured */
+            if (IS_ENABLED(CONFIG_PROSPECTOR_DEEP_SLEEP)) {
+                display_sleep_enter();
+                ui_wake_count_run(UI_WAKE_DISPLAY, false);
+                return;
+            }
 #ifdef CONFIG_PROSPECTOR_SCANNER_TIMEOUT_BRIGHTNESS
             if (CONFIG_PROSPECTOR_SCANNER_TIMEOUT_BRIGHTNESS > 0) {
                 set_pwm_brightness(CONFIG_PROSPECTOR_SCANNER_TIMEOUT_BRIGHTNESS);
                 LOG_INF("Timeout brightness set to %d%%", CONFIG_PROSPECTOR_SCANNER_TIMEOUT_BRIGHTNESS);
             }
 #endif
+            ui_wake_count_run(UI_WAKE_DISPLAY, false);
             return;
         }
 
@@ -523,15 +665,25 @@ static void pending_update_timer_cb(lv_timer_t *timer) {
 #endif
         }
 
+        /* Typing, held modifiers or a layer change keep the dashboard undimmed */
+        panel_idle_note_keyboard(true, data.wpm > 0 || data.modifiers != 0 ||
+                                           data.layer != last_update_layer);
+        last_update_layer = data.layer;
+
         /* Process all updates in main thread - safe to call LVGL */
+        cached_device_stale = data.stale;
         display_update_device_name(data.device_name);
         display_update_layer(data.layer);
         display_update_wpm(data.wpm);
         display_update_connection(data.usb_ready, data.ble_connected,
                                   data.ble_bonded, data.profile);
         display_update_modifiers(data.modifiers);
+        if (!data.stale) {
+            boot_timing_mark(BOOT_PHASE_FIRST_KEYBOARD);
+        }
 
         /* Battery update */
+        memcpy(battery_hours, data.bat_hours, sizeof(battery_hours));
         if (data.bat[1] == 0 && data.bat[2] == 0 && data.bat[3] == 0) {
             display_update_keyboard_battery_4(data.bat[0], 0, 0, 0);
         } else {
@@ -541,113 +693,59 @@ static void pending_update_timer_cb(lv_timer_t *timer) {
     }
 
     /* Check for pending signal update (separate from main data, updates at 1Hz) */
-    /* Read globals directly and update display inline (avoid ALL float function params) */
     if (scanner_is_signal_pending()) {
-        int8_t sig_rssi = scanner_signal_rssi;
-        int32_t sig_rate_x100 = scanner_signal_rate_x100;
-
-        /* Update signal display INLINE (no function call with float param) */
-        rssi = sig_rssi;
-        rate_hz = (float)sig_rate_x100 / 100.0f;
-
-        uint8_t bars = rssi_to_bars(sig_rssi);
-        if (rssi_bar) {
-            lv_bar_set_value(rssi_bar, bars, LV_ANIM_OFF);
-            lv_obj_set_style_bg_color(rssi_bar, get_rssi_color(bars), LV_PART_INDICATOR);
-        }
-        if (rssi_label) {
-            char buf[16];
-            snprintf(buf, sizeof(buf), "%ddBm", sig_rssi);
-            lv_label_set_text(rssi_label, buf);
-        }
-        if (rate_label) {
-            char buf[16];
-            if (sig_rate_x100 < 0) {
-                snprintf(buf, sizeof(buf), "-.--Hz");
-            } else {
-                /* Display from integer directly: rate_x100 / 100 . rate_x100 % 100 */
-                int whole = sig_rate_x100 / 100;
-                int frac = (sig_rate_x100 % 100) / 10;  /* One decimal place */
-                snprintf(buf, sizeof(buf), "%d.%dHz", whole, frac);
-            }
-            lv_label_set_text(rate_label, buf);
-        }
+        idle = false;
+        display_update_signal_x100(scanner_signal_rssi, scanner_signal_rate_x100);
     }
 
     /* Check for pending scanner battery update */
     int scanner_bat;
     if (scanner_get_pending_battery(&scanner_bat)) {
+        idle = false;
         display_update_scanner_battery(scanner_bat);
     }
+
+    ui_wake_count_run(UI_WAKE_DISPLAY, idle);
 }
 
 /* ========== Main Screen Creation (NO CONTAINERS) ========== */
 
-lv_obj_t *zmk_display_status_screen(void) {
-    LOG_INF("=============================================");
-    LOG_INF("=== Full Widget Test - NO CONTAINER ===");
-    LOG_INF("=== All widgets use absolute positioning ===");
-    LOG_INF("=============================================");
-
-    /* Create main screen */
-    LOG_INF("[INIT] Creating main_screen...");
-    lv_obj_t *screen = lv_obj_create(NULL);
-    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
-    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
-    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
-    LOG_INF("[INIT] main_screen created");
-
-    /* ===== 1. Device Name (TOP_MID, y=25) ===== */
-    LOG_INF("[INIT] Creating device name...");
-    device_name_label = lv_label_create(screen);
-    lv_obj_set_style_text_font(device_name_label, &lv_font_unscii_16, 0);
-    lv_obj_set_style_text_color(device_name_label, lv_color_white(), 0);
-    lv_label_set_text(device_name_label, "Scanning...");
-    lv_obj_align(device_name_label, LV_ALIGN_TOP_MID, 0, 25);
-    LOG_INF("[INIT] device name created");
-
-    /* ===== 2. Scanner Battery (TOP_RIGHT area) ===== */
-    /* Shows scanner device's own battery level */
-    LOG_INF("[INIT] Creating scanner battery...");
-    scanner_bat_icon = lv_label_create(screen);
-    lv_obj_set_style_text_font(scanner_bat_icon, &lv_font_montserrat_12, 0);
-    lv_obj_set_pos(scanner_bat_icon, 216, 4);  /* 4px right */
-    lv_label_set_text(scanner_bat_icon, LV_SYMBOL_BATTERY_3);  /* Initial: 3/4 battery */
-    lv_obj_set_style_text_color(scanner_bat_icon, lv_color_hex(0x7FFF00), 0);  /* Lime green */
-
-    scanner_bat_pct = lv_label_create(screen);
-    lv_obj_set_style_text_font(scanner_bat_pct, &lv_font_unscii_8, 0);
-    lv_obj_set_pos(scanner_bat_pct, 238, 7);  /* 2px up */
-    lv_label_set_text(scanner_bat_pct, "?");  /* Unknown until battery read */
-    lv_obj_set_style_text_color(scanner_bat_pct, lv_color_hex(0x7FFF00), 0);
-
-    /* Hide battery widget if disabled */
-    if (!ds_battery_visible) {
-        lv_obj_set_style_opa(scanner_bat_icon, 0, 0);
-        lv_obj_set_style_opa(scanner_bat_pct, 0, 0);
-    }
-    LOG_INF("[INIT] scanner battery created (visible=%d)", ds_battery_visible);
+/* WPM value - digit atlas readout (fixed-cost updates) or plain label */
+static lv_obj_t *create_wpm_value(lv_obj_t *parent) {
+#if IS_ENABLED(CONFIG_PROSPECTOR_DIGIT_ATLAS)
+    lv_obj_t *obj = digit_readout_create(parent, &lv_font_montserrat_16, lv_color_white(),
+                                         lv_color_black(), 3);
+    lv_obj_set_width(obj, 48);  /* Fixed width for centering */
+    digit_readout_set_text(obj, "0");
+#else
+    lv_obj_t *obj = lv_label_create(parent);
+    lv_obj_set_style_text_font(obj, &lv_font_montserrat_16, 0);
+    lv_obj_set_style_text_color(obj, lv_color_white(), 0);
+    lv_obj_set_width(obj, 48);  /* Fixed width for centering */
+    lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, 0);
+    lv_label_set_text(obj, "0");
+#endif
+    lv_obj_set_pos(obj, 8, 66);  /* 3px down */
+    return obj;
+}
 
-    /* ===== 3. WPM Widget (TOP_LEFT, centered under title) ===== */
-    LOG_INF("[INIT] Creating WPM...");
-    wpm_title_label = lv_label_create(screen);
+/* Widgets not needed for the first frame: WPM, connection, modifiers,
+ * keyboard batteries and signal status */
+static void create_main_deferred_widgets(lv_obj_t *parent) {
+    /* ===== 4. WPM Widget (TOP_LEFT, centered under title) ===== */
+    LOG_DBG("[INIT] Creating WPM...");
+    wpm_title_label = lv_label_create(parent);
     lv_obj_set_style_text_font(wpm_title_label, &lv_font_unscii_8, 0);
     lv_obj_set_style_text_color(wpm_title_label, lv_color_make(0xA0, 0xA0, 0xA0), 0);
     lv_label_set_text(wpm_title_label, "WPM");
     lv_obj_set_pos(wpm_title_label, 20, 53);  /* 3px down */
 
-    wpm_value_label = lv_label_create(screen);
-    lv_obj_set_style_text_font(wpm_value_label, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(wpm_value_label, lv_color_white(), 0);
-    lv_obj_set_width(wpm_value_label, 48);  /* Fixed width for centering */
-    lv_obj_set_style_text_align(wpm_value_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_label_set_text(wpm_value_label, "0");
-    lv_obj_set_pos(wpm_value_label, 8, 66);  /* 3px down */
-    LOG_INF("[INIT] WPM created");
-
-    /* ===== 4. Connection Status (TOP_RIGHT) ===== */
-    LOG_INF("[INIT] Creating connection status...");
-    transport_label = lv_label_create(screen);
+    wpm_value_label = create_wpm_value(parent);
+    LOG_DBG("[INIT] WPM created");
+
+    /* ===== 5. Connection Status (TOP_RIGHT) ===== */
+    LOG_DBG("[INIT] Creating connection status...");
+    transport_label = lv_label_create(parent);
     lv_obj_set_style_text_font(transport_label, &lv_font_montserrat_12, 0);
     lv_obj_set_style_text_color(transport_label, lv_color_white(), 0);
     lv_obj_set_style_text_align(transport_label, LV_TEXT_ALIGN_RIGHT, 0);
@@ -658,48 +756,25 @@ lv_obj_t *zmk_display_status_screen(void) {
     lv_label_set_text(transport_label, "#ffffff BLE#\n#ffffff 0#");
 
     /* Profile label kept but hidden (integrated into transport_label) */
-    ble_profile_label = lv_label_create(screen);
+    ble_profile_label = lv_label_create(parent);
     lv_obj_set_style_text_font(ble_profile_label, &lv_font_montserrat_12, 0);
     lv_obj_set_style_text_color(ble_profile_label, lv_color_white(), 0);
     lv_label_set_text(ble_profile_label, "");  /* Hidden - integrated */
     lv_obj_align(ble_profile_label, LV_ALIGN_TOP_RIGHT, -8, 78);
-    LOG_INF("[INIT] connection status created");
-
-    /* ===== 5. Layer Widget (CENTER area, y=85-120) ===== */
-    LOG_INF("[INIT] Creating layer widget...");
-    layer_title_label = lv_label_create(screen);
-    lv_obj_set_style_text_font(layer_title_label, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(layer_title_label, lv_color_make(160, 160, 160), 0);
-    lv_obj_set_style_text_opa(layer_title_label, LV_OPA_70, 0);
-    lv_label_set_text(layer_title_label, "Layer");
-    lv_obj_align(layer_title_label, LV_ALIGN_TOP_MID, 0, 82);  /* 3px up */
-
-    /* Create layer display - slide mode OR fixed mode (list/over-max) */
-    if (ds_layer_slide_mode) {
-        /* Slide mode: create 7-slot dial display */
-        create_layer_slide_widgets(screen, 105);
-        layer_mode_over_max = false;  /* Not used in slide mode */
-    } else if (active_layer >= ds_max_layers) {
-        layer_mode_over_max = true;
-        create_over_max_widget(screen, active_layer, 105);
-    } else {
-        layer_mode_over_max = false;
-        create_layer_list_widgets(screen, 105);
-    }
-    LOG_INF("[INIT] layer widget created");
+    LOG_DBG("[INIT] connection status created");
 
     /* ===== 6. Modifier Widget (CENTER, y=145) - NerdFont icons ===== */
-    LOG_INF("[INIT] Creating modifier widget with NerdFont...");
-    modifier_label = lv_label_create(screen);
+    LOG_DBG("[INIT] Creating modifier widget with NerdFont...");
+    modifier_label = lv_label_create(parent);
     lv_obj_set_style_text_font(modifier_label, &NerdFonts_Regular_40, 0);
     lv_obj_set_style_text_color(modifier_label, lv_color_white(), 0);
     lv_obj_set_style_text_letter_space(modifier_label, 10, 0);  /* Space between icons */
     lv_label_set_text(modifier_label, "");  /* Empty initially */
     lv_obj_align(modifier_label, LV_ALIGN_TOP_MID, 0, 145);
-    LOG_INF("[INIT] modifier widget created");
+    LOG_DBG("[INIT] modifier widget created");
 
     /* ===== 7. Keyboard Battery (dynamic layout for 1-4 batteries) ===== */
-    LOG_INF("[INIT] Creating keyboard battery widgets...");
+    LOG_DBG("[INIT] Creating keyboard battery widgets...");
 
     /* Position constants - configurable for different battery counts */
     #define KB_BAR_HEIGHT      4
@@ -730,7 +805,7 @@ lv_obj_t *zmk_display_status_screen(void) {
         int16_t x_offset = (i < 2) ? kb_x_offsets_2[i] : 0;
 
         /* Connected state bar */
-        kb_bat_bar[i] = lv_bar_create(screen);
+        kb_bat_bar[i] = lv_bar_create(parent);
         lv_obj_set_size(kb_bat_bar[i], bar_width, KB_BAR_HEIGHT);
         lv_obj_align(kb_bat_bar[i], LV_ALIGN_BOTTOM_MID, x_offset, KB_BAR_Y_OFFSET);
         lv_bar_set_range(kb_bat_bar[i], 0, 100);
@@ -747,7 +822,7 @@ lv_obj_t *zmk_display_status_screen(void) {
         lv_obj_set_style_opa(kb_bat_bar[i], 0, LV_PART_INDICATOR);
 
         /* Percentage label (above bar, centered) */
-        kb_bat_pct[i] = lv_label_create(screen);
+        kb_bat_pct[i] = lv_label_create(parent);
         lv_obj_set_style_text_font(kb_bat_pct[i], &lv_font_montserrat_12, 0);
         lv_obj_set_style_text_color(kb_bat_pct[i], lv_color_white(), 0);
         lv_obj_align(kb_bat_pct[i], LV_ALIGN_BOTTOM_MID, x_offset, KB_PCT_Y_OFFSET);
@@ -755,7 +830,7 @@ lv_obj_t *zmk_display_status_screen(void) {
         lv_obj_set_style_opa(kb_bat_pct[i], 0, 0);
 
         /* Name label (left of bar, same height as percentage) */
-        kb_bat_name[i] = lv_label_create(screen);
+        kb_bat_name[i] = lv_label_create(parent);
         lv_obj_set_style_text_font(kb_bat_name[i], &lv_font_montserrat_12, 0);
         lv_obj_set_style_text_color(kb_bat_name[i], lv_color_hex(0x808080), 0);
         lv_obj_align(kb_bat_name[i], LV_ALIGN_BOTTOM_MID, x_offset - bar_width/2 + KB_NAME_X_OFFSET, KB_PCT_Y_OFFSET);
@@ -764,7 +839,7 @@ lv_obj_t *zmk_display_status_screen(void) {
         lv_obj_set_style_opa(kb_bat_name[i], 0, 0);
 
         /* Disconnected state bar */
-        kb_bat_nc_bar[i] = lv_obj_create(screen);
+        kb_bat_nc_bar[i] = lv_obj_create(parent);
         lv_obj_set_size(kb_bat_nc_bar[i], bar_width, KB_BAR_HEIGHT);
         lv_obj_align(kb_bat_nc_bar[i], LV_ALIGN_BOTTOM_MID, x_offset, KB_BAR_Y_OFFSET);
         lv_obj_set_style_bg_color(kb_bat_nc_bar[i], lv_color_hex(0x9e2121), LV_PART_MAIN);
@@ -776,7 +851,7 @@ lv_obj_t *zmk_display_status_screen(void) {
         lv_obj_set_style_opa(kb_bat_nc_bar[i], (i < 2) ? 255 : 0, 0);
 
         /* Disconnected state label (× symbol) */
-        kb_bat_nc_label[i] = lv_label_create(screen);
+        kb_bat_nc_label[i] = lv_label_create(parent);
         lv_obj_set_style_text_font(kb_bat_nc_label[i], &lv_font_montserrat_12, 0);
         lv_obj_set_style_text_color(kb_bat_nc_label[i], lv_color_hex(0xe63030), 0);
         lv_obj_align(kb_bat_nc_label[i], LV_ALIGN_BOTTOM_MID, x_offset, KB_PCT_Y_OFFSET);
@@ -784,24 +859,24 @@ lv_obj_t *zmk_display_status_screen(void) {
         lv_obj_set_style_opa(kb_bat_nc_label[i], (i < 2) ? 255 : 0, 0);
     }
 
-    LOG_INF("[INIT] keyboard battery widgets created (4 slots)");
+    LOG_DBG("[INIT] keyboard battery widgets created (4 slots)");
 
     /* ===== 8. Signal Status (BOTTOM, y=220) ===== */
-    LOG_INF("[INIT] Creating signal status...");
+    LOG_DBG("[INIT] Creating signal status...");
 
-    channel_label = lv_label_create(screen);
+    channel_label = lv_label_create(parent);
     lv_obj_set_style_text_font(channel_label, &lv_font_montserrat_12, 0);
     lv_obj_set_style_text_color(channel_label, lv_color_make(0x80, 0x80, 0x80), 0);
     lv_label_set_text(channel_label, "Ch:0");
     lv_obj_set_pos(channel_label, 62, 219);  /* 5px down, 5px left */
 
-    rx_title_label = lv_label_create(screen);
+    rx_title_label = lv_label_create(parent);
     lv_obj_set_style_text_font(rx_title_label, &lv_font_montserrat_12, 0);
     lv_obj_set_style_text_color(rx_title_label, lv_color_make(0x80, 0x80, 0x80), 0);
     lv_label_set_text(rx_title_label, "RX:");
     lv_obj_set_pos(rx_title_label, 102, 219);  /* 5px down, 5px left */
 
-    rssi_bar = lv_bar_create(screen);
+    rssi_bar = lv_bar_create(parent);
     lv_obj_set_size(rssi_bar, 30, 8);
     lv_obj_set_pos(rssi_bar, 130, 223);  /* RX indicator position */
     lv_bar_set_range(rssi_bar, 0, 5);
@@ -813,46 +888,177 @@ lv_obj_t *zmk_display_status_screen(void) {
     lv_obj_set_style_radius(rssi_bar, 2, LV_PART_MAIN);
     lv_obj_set_style_radius(rssi_bar, 2, LV_PART_INDICATOR);
 
-    rssi_label = lv_label_create(screen);
+    rssi_label = lv_label_create(parent);
     lv_obj_set_style_text_font(rssi_label, &lv_font_montserrat_12, 0);
     lv_obj_set_style_text_color(rssi_label, lv_color_make(0xA0, 0xA0, 0xA0), 0);
     lv_label_set_text(rssi_label, "0dBm");
     lv_obj_set_pos(rssi_label, 167, 219);  /* 5px down, 5px left */
 
-    rate_label = lv_label_create(screen);
+    rate_label = lv_label_create(parent);
     lv_obj_set_style_text_font(rate_label, &lv_font_montserrat_12, 0);
     lv_obj_set_style_text_color(rate_label, lv_color_make(0xA0, 0xA0, 0xA0), 0);
     lv_label_set_text(rate_label, "0.0Hz");
     lv_obj_set_pos(rate_label, 222, 219);  /* 5px down, 5px left */
-    LOG_INF("[INIT] signal status created");
+    LOG_DBG("[INIT] signal status created");
+}
+
+/* Build the deferred main widgets if they do not exist yet */
+static void main_build_deferred(void) {
+    lv_obj_t *main_cont = screen_containers[SCREEN_MAIN];
+    if (!main_cont || wpm_value_label) {
+        return;
+    }
+
+    create_main_deferred_widgets(main_cont);
+
+    /* Apply data that arrived while the widgets did not exist */
+    display_update_wpm(wpm_value);
+    display_update_connection(usb_ready, ble_connected, ble_bonded, ble_profile);
+    display_update_modifiers(cached_modifiers);
+    if (battery_values[0] || battery_values[1] || battery_values[2] || battery_values[3]) {
+        active_battery_count = -1;  /* Force reposition */
+        display_update_keyboard_battery_4(battery_values[0], battery_values[1],
+                                          battery_values[2], battery_values[3]);
+    }
+    if (rate_x100 >= 0) {
+        display_update_signal_x100(rssi, rate_x100);
+    }
+
+    boot_timing_mark(BOOT_PHASE_UI_COMPLETE);
+    LOG_INF("Main screen widgets complete");
+}
 
-    LOG_INF("=============================================");
-    LOG_INF("=== Full Widget Test Complete ===");
-    LOG_INF("=== Swipe DOWN for Settings, UP to return ===");
-    LOG_INF("=============================================");
+/* One-shot LVGL timer: first timer pass after the screen was loaded */
+static void main_deferred_timer_cb(lv_timer_t *timer) {
+    ARG_UNUSED(timer);
+    main_deferred_timer = NULL;  /* Repeat count 1 - deleted by LVGL after this call */
+
+    /* Put the minimal screen on the panel before building the rest */
+    lv_refr_now(NULL);
+    boot_timing_mark(BOOT_PHASE_FIRST_FRAME);
+
+    /* If the user already swiped away, main is completed when shown again */
+    if (current_screen == SCREEN_MAIN) {
+        main_build_deferred();
+    }
+}
+
+lv_obj_t *zmk_display_status_screen(void) {
+    boot_timing_mark(BOOT_PHASE_SCREEN_CREATE);
+    ui_bind_init();
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SETTINGS_STORE)
+    /* Stored values first, so the first frame already uses them */
+    ds_settings_restore();
+#endif
+
+    /* Create root screen; each screen lives in its own container on it */
+    LOG_DBG("[INIT] Creating main_screen...");
+    root_screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(root_screen, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(root_screen, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(root_screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_t *screen = screen_container_create(SCREEN_MAIN, 0x000000);
+    LOG_DBG("[INIT] main_screen created");
+
+    /* ===== 1. Device Name (TOP_MID, y=25) ===== */
+    LOG_DBG("[INIT] Creating device name...");
+    device_name_label = lv_label_create(screen);
+    lv_obj_set_style_text_font(device_name_label, &lv_font_unscii_16, 0);
+    lv_obj_set_style_text_color(device_name_label, lv_color_white(), 0);
+    lv_label_set_text(device_name_label, "Scanning...");
+    lv_obj_align(device_name_label, LV_ALIGN_TOP_MID, 0, 25);
+    LOG_DBG("[INIT] device name created");
+
+    /* ===== 2. Scanner Battery (TOP_RIGHT area) ===== */
+    /* Shows scanner device's own battery level */
+    LOG_DBG("[INIT] Creating scanner battery...");
+    scanner_bat_icon = lv_label_create(screen);
+    lv_obj_set_style_text_font(scanner_bat_icon, &lv_font_montserrat_12, 0);
+    lv_obj_set_pos(scanner_bat_icon, 216, 4);  /* 4px right */
+    lv_label_set_text(scanner_bat_icon, LV_SYMBOL_BATTERY_3);  /* Initial: 3/4 battery */
+    lv_obj_set_style_text_color(scanner_bat_icon, lv_color_hex(0x7FFF00), 0);  /* Lime green */
+
+    scanner_bat_pct = lv_label_create(screen);
+    lv_obj_set_style_text_font(scanner_bat_pct, &lv_font_unscii_8, 0);
+    lv_obj_set_pos(scanner_bat_pct, 238, 7);  /* 2px up */
+    lv_label_set_text(scanner_bat_pct, "?");  /* Unknown until battery read */
+    lv_obj_set_style_text_color(scanner_bat_pct, lv_color_hex(0x7FFF00), 0);
+
+    /* Hide battery widget if disabled */
+    if (!ds_battery_visible) {
+        lv_obj_set_style_opa(scanner_bat_icon, 0, 0);
+        lv_obj_set_style_opa(scanner_bat_pct, 0, 0);
+    }
+    LOG_DBG("[INIT] scanner battery created (visible=%d)", ds_battery_visible);
+
+    /* ===== 3. Layer Widget (CENTER area, y=85-120) ===== */
+    LOG_DBG("[INIT] Creating layer widget...");
+    layer_title_label = lv_label_create(screen);
+    lv_obj_set_style_text_font(layer_title_label, &lv_font_montserrat_16, 0);
+    lv_obj_set_style_text_color(layer_title_label, lv_color_make(160, 160, 160), 0);
+    lv_obj_set_style_text_opa(layer_title_label, LV_OPA_70, 0);
+    lv_label_set_text(layer_title_label, "Layer");
+    lv_obj_align(layer_title_label, LV_ALIGN_TOP_MID, 0, 82);  /* 3px up */
+
+    /* Create layer display - slide mode OR fixed mode (list/over-max) */
+    if (ds_layer_slide_mode) {
+        /* Slide mode: create 7-slot dial display */
+        create_layer_slide_widgets(screen, 105);
+        layer_mode_over_max = false;  /* Not used in slide mode */
+    } else if (active_layer >= ds_max_layers) {
+        layer_mode_over_max = true;
+        create_over_max_widget(screen, active_layer, 105);
+    } else {
+        layer_mode_over_max = false;
+        create_layer_list_widgets(screen, 105);
+    }
+    LOG_DBG("[INIT] layer widget created");
+
+    LOG_INF("Main screen created (minimal), remaining widgets deferred");
 
     /* Save screen reference for screen transitions */
     screen_obj = screen;
     current_screen = SCREEN_MAIN;
+    main_built_slide_mode = ds_layer_slide_mode;
+    main_built_max_layers = ds_max_layers;
 
     /* Register LVGL timer for swipe processing in main thread
-     * This timer checks the pending_swipe flag every 50ms and processes
-     * screen transitions safely in the LVGL timer context (main thread).
+     * The swipe listener sets the pending_swipe flag and wakes this timer,
+     * which processes screen transitions safely in the LVGL timer context
+     * (main thread). Without event wakeups it polls every 50ms.
      *
      * DESIGN: ISR sets flag → LVGL timer processes → Thread-safe LVGL ops
      */
     if (!swipe_process_timer) {
         swipe_process_timer = lv_timer_create(swipe_process_timer_cb, 50, NULL);
-        LOG_INF("Swipe processing timer registered (50ms interval)");
+        ui_wake_bind(UI_WAKE_SWIPE, swipe_process_timer, 50);
+        LOG_INF("Swipe processing timer registered");
     }
 
-    /* Create pending update timer - processes Work Queue data in main thread */
+    /* Create pending update timer - processes Work Queue data in main thread,
+     * woken by scanner_stub.c when data is pending (100ms polling without) */
     if (!pending_update_timer) {
         pending_update_timer = lv_timer_create(pending_update_timer_cb, 100, NULL);
-        LOG_INF("Pending update timer registered (100ms interval)");
+        ui_wake_bind(UI_WAKE_DISPLAY, pending_update_timer, 100);
+        LOG_INF("Pending update timer registered");
     }
 
-    return screen;
+    /* Remaining widgets are built after the first frame has been flushed */
+    if (!main_deferred_timer) {
+        main_deferred_timer = lv_timer_create(main_deferred_timer_cb, 0, NULL);
+        lv_timer_set_repeat_count(main_deferred_timer, 1);
+    }
+
+    display_sched_start();
+    frame_stats_start();
+    flush_opt_start();
+    display_sleep_init(display_sleep_backlight);
+    panel_idle_init(panel_dim_backlight);
+    render_bench_scenes_register();
+    perf_overlay_set_visible(IS_ENABLED(CONFIG_PROSPECTOR_PERF_OVERLAY_DEFAULT_ON));
+
+    return root_screen;
 }
 
 /* ========== Widget Update Functions (called from scanner_stub.c) ========== */
@@ -863,7 +1069,9 @@ void display_update_device_name(const char *name) {
         cached_device_name[sizeof(cached_device_name) - 1] = '\0';
     }
     if (device_name_label && name) {
-        lv_label_set_text(device_name_label, name);
+        ui_bind_label_text(device_name_label, name);
+        ui_bind_text_color(device_name_label,
+                           cached_device_stale ? lv_color_hex(0x808080) : lv_color_white(), 0);
     }
 }
 
@@ -872,8 +1080,8 @@ void display_update_scanner_battery(int level) {
 
     /* If scanner battery widget is disabled via settings, hide it */
     if (!ds_battery_visible) {
-        if (scanner_bat_icon) lv_obj_set_style_opa(scanner_bat_icon, 0, 0);
-        if (scanner_bat_pct) lv_obj_set_style_opa(scanner_bat_pct, 0, 0);
+        ui_bind_opa(scanner_bat_icon, 0, 0);
+        ui_bind_opa(scanner_bat_pct, 0, 0);
         return;
     }
 
@@ -887,26 +1095,22 @@ void display_update_scanner_battery(int level) {
     lv_color_t display_color = is_charging ? lv_color_hex(0x007FFF) : get_scanner_battery_color(level);
 
     if (scanner_bat_icon) {
-        lv_obj_set_style_opa(scanner_bat_icon, 255, 0);  /* Ensure visible */
+        ui_bind_opa(scanner_bat_icon, 255, 0);  /* Ensure visible */
         if (is_charging) {
             /* Show charge symbol + battery icon, move 3px left to accommodate wider icon */
-            static char combined_icon[16];
-            snprintf(combined_icon, sizeof(combined_icon), LV_SYMBOL_CHARGE "%s", get_battery_icon(level));
-            lv_label_set_text(scanner_bat_icon, combined_icon);
-            lv_obj_set_pos(scanner_bat_icon, 213, 4);  /* 3px left when charging */
+            ui_bind_label_fmt(scanner_bat_icon, LV_SYMBOL_CHARGE "%s", get_battery_icon(level));
+            ui_bind_pos(scanner_bat_icon, 213, 4);  /* 3px left when charging */
         } else {
-            lv_label_set_text(scanner_bat_icon, get_battery_icon(level));
-            lv_obj_set_pos(scanner_bat_icon, 216, 4);  /* Normal position */
+            ui_bind_label_text(scanner_bat_icon, get_battery_icon(level));
+            ui_bind_pos(scanner_bat_icon, 216, 4);  /* Normal position */
         }
-        lv_obj_set_style_text_color(scanner_bat_icon, display_color, 0);
+        ui_bind_text_color(scanner_bat_icon, display_color, 0);
     }
 
     if (scanner_bat_pct) {
-        lv_obj_set_style_opa(scanner_bat_pct, 255, 0);  /* Ensure visible */
-        char buf[8];
-        snprintf(buf, sizeof(buf), "%d", level);
-        lv_label_set_text(scanner_bat_pct, buf);
-        lv_obj_set_style_text_color(scanner_bat_pct, display_color, 0);
+        ui_bind_opa(scanner_bat_pct, 255, 0);  /* Ensure visible */
+        ui_bind_label_fmt(scanner_bat_pct, "%d", level);
+        ui_bind_text_color(scanner_bat_pct, display_color, 0);
     }
 }
 
@@ -1424,16 +1628,16 @@ void display_update_layer(int layer) {
         /* Update normal layer list - just update colors, pulse on active */
         for (int i = 0; i < ds_max_layers && i < 10 && layer_labels[i]; i++) {
             if (i == active_layer) {
-                lv_obj_set_style_text_color(layer_labels[i], get_layer_color(i), 0);
-                lv_obj_set_style_text_opa(layer_labels[i], LV_OPA_COVER, 0);
+                ui_bind_text_color(layer_labels[i], get_layer_color(i), 0);
+                ui_bind_text_opa(layer_labels[i], LV_OPA_COVER, 0);
 
                 /* Pulse animation on active layer change */
                 if (prev_layer != layer) {
                     start_pulse_anim(layer_labels[i]);
                 }
             } else {
-                lv_obj_set_style_text_color(layer_labels[i], lv_color_make(40, 40, 40), 0);
-                lv_obj_set_style_text_opa(layer_labels[i], LV_OPA_30, 0);
+                ui_bind_text_color(layer_labels[i], lv_color_make(40, 40, 40), 0);
+                ui_bind_text_opa(layer_labels[i], LV_OPA_30, 0);
             }
         }
     }
@@ -1443,11 +1647,11 @@ void display_update_layer(int layer) {
 
 void display_update_wpm(int wpm) {
     wpm_value = wpm;  /* Cache for screen transitions */
-    if (wpm_value_label) {
-        char buf[8];
-        snprintf(buf, sizeof(buf), "%d", wpm);
-        lv_label_set_text(wpm_value_label, buf);
-    }
+#if IS_ENABLED(CONFIG_PROSPECTOR_DIGIT_ATLAS)
+    digit_readout_set_int(wpm_value_label, wpm);
+#else
+    ui_bind_label_fmt(wpm_value_label, "%d", wpm);
+#endif
 }
 
 void display_update_connection(bool usb_rdy, bool ble_conn, bool ble_bond, int profile) {
@@ -1460,7 +1664,7 @@ void display_update_connection(bool usb_rdy, bool ble_conn, bool ble_bond, int p
         /* Exclusive display: USB or BLE (not both) */
         if (usb_ready) {
             /* USB connected - show USB only */
-            lv_label_set_text(transport_label, "#ffffff USB#");
+            ui_bind_label_text(transport_label, "#ffffff USB#");
         } else {
             /* USB not connected - show BLE with profile number on new line
              * BLE text colors:
@@ -1480,14 +1684,12 @@ void display_update_connection(bool usb_rdy, bool ble_conn, bool ble_bond, int p
             char transport_text[32];
             snprintf(transport_text, sizeof(transport_text),
                     "#%s BLE#\n#ffffff %d#", ble_color, profile);
-            lv_label_set_text(transport_label, transport_text);
+            ui_bind_label_text(transport_label, transport_text);
         }
     }
 
     /* Hide profile label - now integrated into transport_label */
-    if (ble_profile_label) {
-        lv_label_set_text(ble_profile_label, "");
-    }
+    ui_bind_label_text(ble_profile_label, "");
 }
 
 void display_update_modifiers(uint8_t mods) {
@@ -1511,7 +1713,7 @@ void display_update_modifiers(uint8_t mods) {
         }
 
         /* Empty string when no modifiers active */
-        lv_label_set_text(modifier_label, mod_text);
+        ui_bind_label_text(modifier_label, mod_text);
     }
 }
 
@@ -1614,6 +1816,17 @@ static void reposition_battery_widgets(int count) {
     LOG_INF("Battery widgets repositioned for count=%d", count);
 }
 
+/* "85" or, with a runtime estimate, "85 ~12d" (under 2 days: "85 ~30h") */
+static void format_battery_pct(char *buf, size_t len, int val, uint16_t hours) {
+    if (hours == 0) {
+        snprintf(buf, len, "%d", val);
+    } else if (hours < 48) {
+        snprintf(buf, len, "%d ~%uh", val, hours);
+    } else {
+        snprintf(buf, len, "%d ~%ud", val, (hours + 12) / 24);
+    }
+}
+
 void display_update_keyboard_battery_4(int bat0, int bat1, int bat2, int bat3) {
     int values[MAX_KB_BATTERIES] = {bat0, bat1, bat2, bat3};
 
@@ -1640,44 +1853,44 @@ void display_update_keyboard_battery_4(int bat0, int bat1, int bat2, int bat3) {
 
         if (slot_visible && val > 0) {
             /* Connected: show bar and percentage, hide × */
-            if (kb_bat_nc_bar[i]) lv_obj_set_style_opa(kb_bat_nc_bar[i], 0, 0);
-            if (kb_bat_nc_label[i]) lv_obj_set_style_opa(kb_bat_nc_label[i], 0, 0);
+            ui_bind_opa(kb_bat_nc_bar[i], 0, 0);
+            ui_bind_opa(kb_bat_nc_label[i], 0, 0);
             if (kb_bat_bar[i]) {
-                lv_obj_set_style_opa(kb_bat_bar[i], 255, LV_PART_MAIN);
-                lv_obj_set_style_opa(kb_bat_bar[i], 255, LV_PART_INDICATOR);
+                ui_bind_opa(kb_bat_bar[i], 255, LV_PART_MAIN);
+                ui_bind_opa(kb_bat_bar[i], 255, LV_PART_INDICATOR);
                 lv_bar_set_value(kb_bat_bar[i], val, LV_ANIM_OFF);
-                lv_obj_set_style_bg_color(kb_bat_bar[i], get_keyboard_battery_color(val), LV_PART_INDICATOR);
+                ui_bind_bg_color(kb_bat_bar[i], get_keyboard_battery_color(val), LV_PART_INDICATOR);
             }
             if (kb_bat_pct[i]) {
-                lv_obj_set_style_opa(kb_bat_pct[i], 255, 0);
+                ui_bind_opa(kb_bat_pct[i], 255, 0);
                 char buf[16];
-                snprintf(buf, sizeof(buf), "%d", val);
-                lv_label_set_text(kb_bat_pct[i], buf);
-                lv_obj_set_style_text_color(kb_bat_pct[i], get_keyboard_battery_color(val), 0);
+                format_battery_pct(buf, sizeof(buf), val, battery_hours[i]);
+                ui_bind_label_text(kb_bat_pct[i], buf);
+                ui_bind_text_color(kb_bat_pct[i], get_keyboard_battery_color(val), 0);
             }
             if (kb_bat_name[i]) {
-                lv_obj_set_style_opa(kb_bat_name[i], 255, 0);
+                ui_bind_opa(kb_bat_name[i], 255, 0);
             }
         } else if (slot_visible) {
             /* Disconnected: show ×, hide bar and percentage */
             if (kb_bat_bar[i]) {
-                lv_obj_set_style_opa(kb_bat_bar[i], 0, LV_PART_MAIN);
-                lv_obj_set_style_opa(kb_bat_bar[i], 0, LV_PART_INDICATOR);
+                ui_bind_opa(kb_bat_bar[i], 0, LV_PART_MAIN);
+                ui_bind_opa(kb_bat_bar[i], 0, LV_PART_INDICATOR);
             }
-            if (kb_bat_pct[i]) lv_obj_set_style_opa(kb_bat_pct[i], 0, 0);
-            if (kb_bat_name[i]) lv_obj_set_style_opa(kb_bat_name[i], 255, 0);
-            if (kb_bat_nc_bar[i]) lv_obj_set_style_opa(kb_bat_nc_bar[i], 255, 0);
-            if (kb_bat_nc_label[i]) lv_obj_set_style_opa(kb_bat_nc_label[i], 255, 0);
+            ui_bind_opa(kb_bat_pct[i], 0, 0);
+            ui_bind_opa(kb_bat_name[i], 255, 0);
+            ui_bind_opa(kb_bat_nc_bar[i], 255, 0);
+            ui_bind_opa(kb_bat_nc_label[i], 255, 0);
         } else {
             /* Slot not visible (beyond active count or count=0) - hide everything */
             if (kb_bat_bar[i]) {
-                lv_obj_set_style_opa(kb_bat_bar[i], 0, LV_PART_MAIN);
-                lv_obj_set_style_opa(kb_bat_bar[i], 0, LV_PART_INDICATOR);
+                ui_bind_opa(kb_bat_bar[i], 0, LV_PART_MAIN);
+                ui_bind_opa(kb_bat_bar[i], 0, LV_PART_INDICATOR);
             }
-            if (kb_bat_pct[i]) lv_obj_set_style_opa(kb_bat_pct[i], 0, 0);
-            if (kb_bat_name[i]) lv_obj_set_style_opa(kb_bat_name[i], 0, 0);
-            if (kb_bat_nc_bar[i]) lv_obj_set_style_opa(kb_bat_nc_bar[i], 0, 0);
-            if (kb_bat_nc_label[i]) lv_obj_set_style_opa(kb_bat_nc_label[i], 0, 0);
+            ui_bind_opa(kb_bat_pct[i], 0, 0);
+            ui_bind_opa(kb_bat_name[i], 0, 0);
+            ui_bind_opa(kb_bat_nc_bar[i], 0, 0);
+            ui_bind_opa(kb_bat_nc_label[i], 0, 0);
         }
     }
 }
@@ -1687,39 +1900,43 @@ void display_update_keyboard_battery(int left, int right) {
     display_update_keyboard_battery_4(left, right, 0, 0);
 }
 
+/* Float interface kept for callers outside the 1 Hz path */
 void display_update_signal(int8_t rssi_val, float rate) {
+    int32_t x100 = -100;
+    if (rate >= 0.0f) {
+        /* NaN fails every compare and stays "no data" */
+        x100 = rate > 999.9f ? INT32_MAX : (int32_t)(rate * 100.0f + 0.5f);
+    }
+    display_update_signal_x100(rssi_val, x100);
+}
+
+/* Integer-only: rate arrives as rate * 100 from scanner_stub.c */
+void display_update_signal_x100(int8_t rssi_val, int32_t rate_x100_val) {
     rssi = rssi_val;
-    rate_hz = rate;
+    rate_x100 = rate_x100_val;
 
     uint8_t bars = rssi_to_bars(rssi_val);
 
-    if (rssi_bar) {
-        lv_bar_set_value(rssi_bar, bars, LV_ANIM_OFF);
-        lv_obj_set_style_bg_color(rssi_bar, get_rssi_color(bars), LV_PART_INDICATOR);
-    }
+    ui_bind_bar_value(rssi_bar, bars);
+    ui_bind_bg_color(rssi_bar, get_rssi_color(bars), LV_PART_INDICATOR);
 
-    if (rssi_label) {
-        char buf[16];
-        snprintf(buf, sizeof(buf), "%ddBm", rssi_val);
-        lv_label_set_text(rssi_label, buf);
-    }
+    ui_bind_label_fmt(rssi_label, "%ddBm", rssi_val);
 
     if (rate_label) {
         char buf[16];
         /* Robust rate display: handle invalid/out-of-range values */
-        if (rate < 0.0f) {
+        if (rate_x100_val < 0) {
             /* Negative = no data yet */
             snprintf(buf, sizeof(buf), "-.--Hz");
-        } else if (rate > 999.9f || rate != rate) {  /* rate != rate checks for NaN */
-            LOG_WRN("Invalid rate value: %.2f, displaying as -.--", (double)rate);
+        } else if (rate_x100_val > 99990) {
+            LOG_WRN("Invalid rate value x100: %d, displaying as -.--", (int)rate_x100_val);
             snprintf(buf, sizeof(buf), "-.--Hz");
         } else {
-            /* Safe conversion with rounding */
-            int rate_int = (int)(rate * 10.0f + 0.5f);
-            if (rate_int > 9999) rate_int = 9999;  /* Cap at 999.9Hz */
-            snprintf(buf, sizeof(buf), "%d.%dHz", rate_int / 10, rate_int % 10);
+            /* Round to tenths */
+            int rate_tenths = (rate_x100_val + 5) / 10;
+            snprintf(buf, sizeof(buf), "%d.%dHz", rate_tenths / 10, rate_tenths % 10);
         }
-        lv_label_set_text(rate_label, buf);
+        ui_bind_label_text(rate_label, buf);
     }
 }
 
@@ -1817,13 +2034,7 @@ static void create_main_screen_widgets(void) {
     lv_label_set_text(wpm_title_label, "WPM");
     lv_obj_set_pos(wpm_title_label, 20, 53);  /* 3px down */
 
-    wpm_value_label = lv_label_create(screen_obj);
-    lv_obj_set_style_text_font(wpm_value_label, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(wpm_value_label, lv_color_white(), 0);
-    lv_obj_set_width(wpm_value_label, 48);  /* Fixed width for centering */
-    lv_obj_set_style_text_align(wpm_value_label, LV_TEXT_ALIGN_CENTER, 0);
-    lv_label_set_text(wpm_value_label, "0");
-    lv_obj_set_pos(wpm_value_label, 8, 66);  /* 3px down */
+    wpm_value_label = create_wpm_value(screen_obj);
 
     transport_label = lv_label_create(screen_obj);
     lv_obj_set_style_text_font(transport_label, &lv_font_montserrat_12, 0);
@@ -1987,7 +2198,7 @@ static void create_main_screen_widgets(void) {
     /* Now update battery display with values */
     display_update_keyboard_battery_4(battery_values[0], battery_values[1], battery_values[2], battery_values[3]);
 
-    display_update_signal(rssi, rate_hz);
+    display_update_signal_x100(rssi, rate_x100);
 
     LOG_INF("Cached values restored");
 }
@@ -2118,8 +2329,10 @@ static void auto_brightness_timer_cb(lv_timer_t *timer) {
     ARG_UNUSED(timer);
 
     if (!ds_auto_brightness_enabled || !brightness_control_sensor_available()) {
+        ui_wake_count_run(UI_WAKE_BRIGHTNESS, true);
         return;
     }
+    ui_wake_count_run(UI_WAKE_BRIGHTNESS, false);
 
     uint16_t light_val = 0;
     int ret = brightness_control_read_sensor(&light_val);
@@ -2145,6 +2358,7 @@ static void ds_auto_switch_event_cb(lv_event_t *e) {
     lv_obj_t *sw = lv_event_get_target(e);
     bool checked = lv_obj_has_state(sw, LV_STATE_CHECKED);
     ds_auto_brightness_enabled = checked;
+    ds_settings_changed();
 
     /* Enable/disable the brightness control module's auto mode */
     brightness_control_set_auto(checked);
@@ -2153,11 +2367,13 @@ static void ds_auto_switch_event_cb(lv_event_t *e) {
     if (checked && brightness_control_sensor_available()) {
         if (!auto_brightness_timer) {
             auto_brightness_timer = lv_timer_create(auto_brightness_timer_cb, AUTO_BRIGHTNESS_INTERVAL_MS, NULL);
-            LOG_INF("Auto brightness timer started (%d ms interval)", AUTO_BRIGHTNESS_INTERVAL_MS);
+            ui_wake_bind(UI_WAKE_BRIGHTNESS, auto_brightness_timer, AUTO_BRIGHTNESS_INTERVAL_MS);
+            LOG_INF("Auto brightness timer started");
         }
         /* Trigger immediate sensor read */
         auto_brightness_timer_cb(NULL);
     } else if (auto_brightness_timer) {
+        ui_wake_bind(UI_WAKE_BRIGHTNESS, NULL, 0);
         lv_timer_del(auto_brightness_timer);
         auto_brightness_timer = NULL;
         LOG_INF("Auto brightness timer stopped");
@@ -2195,6 +2411,7 @@ static void ds_brightness_slider_event_cb(lv_event_t *e) {
 
     int value = lv_slider_get_value(slider);
     ds_manual_brightness = (uint8_t)value;
+    ds_settings_changed();
 
     /* Update value label */
     if (ds_brightness_value) {
@@ -2217,6 +2434,7 @@ static void ds_battery_switch_event_cb(lv_event_t *e) {
 
     lv_obj_t *sw = lv_event_get_target(e);
     ds_battery_visible = lv_obj_has_state(sw, LV_STATE_CHECKED);
+    ds_settings_changed();
     LOG_INF("Scanner battery widget: %s", ds_battery_visible ? "visible" : "hidden");
 
     /* Immediately update scanner battery widget visibility using cached value */
@@ -2238,6 +2456,7 @@ static void ds_layer_slider_event_cb(lv_event_t *e) {
 
     int value = lv_slider_get_value(slider);
     ds_max_layers = (uint8_t)value;
+    ds_settings_changed();
 
     /* Update value label */
     if (ds_layer_value) {
@@ -2256,6 +2475,7 @@ static void ds_slide_switch_event_cb(lv_event_t *e) {
     lv_obj_t *sw = lv_event_get_target(e);
     bool checked = lv_obj_has_state(sw, LV_STATE_CHECKED);
     ds_layer_slide_mode = checked;
+    ds_settings_changed();
 
     LOG_INF("Layer slide mode: %s", checked ? "ON" : "OFF");
 
@@ -2290,6 +2510,24 @@ static void ss_bootloader_btn_event_cb(lv_event_t *e) {
     }
 }
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_PERF_OVERLAY)
+static void ss_perf_btn_update(void) {
+    if (!ss_perf_btn) return;
+
+    bool on = perf_overlay_is_visible();
+    lv_label_set_text(ss_perf_label, on ? "Stats: On" : "Stats: Off");
+    lv_obj_set_style_bg_color(ss_perf_btn, lv_color_hex(on ? 0x2E7D32 : 0x333333),
+                              LV_STATE_DEFAULT);
+}
+
+static void ss_perf_btn_event_cb(lv_event_t *e) {
+    if (lv_event_get_code(e) == LV_EVENT_CLICKED) {
+        perf_overlay_set_visible(!perf_overlay_is_visible());
+        ss_perf_btn_update();
+    }
+}
+#endif
+
 static void ss_reset_btn_event_cb(lv_event_t *e) {
     lv_event_code_t code = lv_event_get_code(e);
 
@@ -2550,6 +2788,7 @@ static void create_display_settings_widgets(void) {
 static void destroy_system_settings_widgets(void) {
     LOG_INF("Destroying system settings widgets...");
     if (ss_nav_hint) { lv_obj_del(ss_nav_hint); ss_nav_hint = NULL; }
+    if (ss_perf_btn) { lv_obj_del(ss_perf_btn); ss_perf_btn = NULL; ss_perf_label = NULL; }
     if (ss_reset_btn) { lv_obj_del(ss_reset_btn); ss_reset_btn = NULL; }
     if (ss_bootloader_btn) { lv_obj_del(ss_bootloader_btn); ss_bootloader_btn = NULL; }
     if (ss_version_label) { lv_obj_del(ss_version_label); ss_version_label = NULL; }
@@ -2630,6 +2869,22 @@ static void create_system_settings_widgets(void) {
     lv_label_set_text(ss_nav_hint, LV_SYMBOL_LEFT " Main");
     lv_obj_align(ss_nav_hint, LV_ALIGN_BOTTOM_MID, 0, -10);
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_PERF_OVERLAY)
+    /* Stats overlay toggle (bottom right, beside the navigation hint) */
+    ss_perf_btn = lv_btn_create(screen_obj);
+    lv_obj_set_size(ss_perf_btn, 74, 26);
+    lv_obj_align(ss_perf_btn, LV_ALIGN_BOTTOM_RIGHT, -6, -6);
+    lv_obj_set_style_bg_color(ss_perf_btn, lv_color_hex(0x555555), LV_STATE_PRESSED);
+    lv_obj_set_style_radius(ss_perf_btn, 6, LV_STATE_DEFAULT);
+    lv_obj_add_event_cb(ss_perf_btn, ss_perf_btn_event_cb, LV_EVENT_CLICKED, NULL);
+
+    ss_perf_label = lv_label_create(ss_perf_btn);
+    lv_obj_set_style_text_color(ss_perf_label, lv_color_white(), LV_STATE_DEFAULT);
+    lv_obj_set_style_text_font(ss_perf_label, &lv_font_montserrat_12, LV_STATE_DEFAULT);
+    lv_obj_center(ss_perf_label);
+    ss_perf_btn_update();
+#endif
+
     LOG_INF("System settings widgets created");
 }
 
@@ -2638,6 +2893,9 @@ static void create_system_settings_widgets(void) {
 /* External functions from scanner_stub.c */
 extern int scanner_get_selected_keyboard(void);
 extern void scanner_set_selected_keyboard(int index);
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+extern uint32_t scanner_get_auto_follow_switches(void);
+#endif
 
 /* RSSI helper functions (same as original keyboard_list_widget.c) */
 static uint8_t ks_rssi_to_bars(int8_t rssi) {
@@ -3025,6 +3283,15 @@ static void ks_update_entries(void) {
 
     uint8_t scanner_ch = scanner_get_runtime_channel();
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+    /* Auto-follow changed the shown keyboard - move the highlight with it */
+    uint32_t follow_switches = scanner_get_auto_follow_switches();
+    if (follow_switches != ks_follow_switches) {
+        ks_follow_switches = follow_switches;
+        ks_selected_keyboard = scanner_get_selected_keyboard();
+    }
+#endif
+
     for (int i = 0; i < CONFIG_PROSPECTOR_MAX_KEYBOARDS && active_count < KS_MAX_KEYBOARDS; i++) {
         struct zmk_keyboard_status *kbd = zmk_status_scanner_get_keyboard(i);
         if (!kbd || !kbd->active) continue;
@@ -3132,9 +3399,11 @@ static void ks_update_timer_cb(lv_timer_t *timer) {
     ARG_UNUSED(timer);
 
     if (transition_in_progress || ui_interaction_active) {
+        ui_wake_count_run(UI_WAKE_KEYBOARDS, true);
         return;
     }
 
+    ui_wake_count_run(UI_WAKE_KEYBOARDS, false);
     ks_update_entries();
 }
 
@@ -3143,6 +3412,7 @@ static void destroy_keyboard_select_widgets(void) {
 
     /* Stop update timer */
     if (ks_update_timer) {
+        ui_wake_bind(UI_WAKE_KEYBOARDS, NULL, 0);
         lv_timer_del(ks_update_timer);
         ks_update_timer = NULL;
     }
@@ -3221,8 +3491,10 @@ static void create_keyboard_select_widgets(void) {
     /* Create initial keyboard entries */
     ks_update_entries();
 
-    /* Start update timer (1 second interval) */
+    /* Start update timer - woken on keyboard changes and 1Hz signal updates
+     * (1 second polling without event wakeups) */
     ks_update_timer = lv_timer_create(ks_update_timer_cb, 1000, NULL);
+    ui_wake_bind(UI_WAKE_KEYBOARDS, ks_update_timer, 1000);
 
     LOG_INF("Keyboard select widgets created (%d keyboards)", ks_entry_count);
 }
@@ -3230,10 +3502,14 @@ static void create_keyboard_select_widgets(void) {
 /* ========== Pong Wars Screen ========== */
 
 /*
- * Pong Wars - Pre-allocated cell version (stable)
- * - ALL cell objects created at init (no dynamic alloc during game)
- * - Cell conversion just changes color (no create/delete)
- * - Much more stable on resource-constrained devices
+ * Pong Wars - single custom-drawn arena
+ * - The arena is ONE object; its DRAW_MAIN handler paints the cells from a
+ *   1-bit ownership bitmap, the balls and the border (no per-cell objects,
+ *   ~10KB less LVGL heap than 108 cell objects)
+ * - A converted cell or a moved ball invalidates only its own rectangle,
+ *   so a frame redraws a few hundred pixels instead of object subtrees
+ * - Frame statistics ("prospector pong") make the screen a display
+ *   pipeline benchmark: game step, render time and rendered FPS
  */
 
 #define PW_CELL_SIZE 20       /* Cell size in pixels */
@@ -3246,6 +3522,11 @@ static void create_keyboard_select_widgets(void) {
 #define PW_ARENA_H 180        /* 75% of 240 */
 #define PW_OFFSET_X 20        /* (280 - 240) / 2 */
 #define PW_OFFSET_Y 30        /* Top margin for score */
+#define PW_RADIUS 8           /* Arena corner radius */
+#define PW_BORDER 2           /* Arena border width */
+#define PW_SUBPX 10           /* Ball position/velocity fixed point (1/10 px) */
+#define PW_BASE_FRAME_MS 33   /* Frame time the speeds were tuned for */
+#define PW_FRAME_MS (1000 / CONFIG_PROSPECTOR_PONG_FPS)
 
 /* Pastel color palettes - {team1_bg, team2_bg, team1_ball, team2_ball} */
 static const uint32_t pw_color_palettes[][4] = {
@@ -3266,25 +3547,40 @@ static uint32_t pw_color_ball2 = 0x2D8CFF;
 
 /* State */
 static lv_timer_t *pw_timer = NULL;
-static uint8_t pw_grid[PW_NUM_CELLS];  /* Cell ownership: 0=team1, 1=team2 */
-static lv_obj_t *pw_cell_objs[PW_NUM_CELLS];  /* Pre-allocated cell objects */
-static lv_obj_t *pw_arena_container = NULL;  /* Container for arena */
-static lv_obj_t *pw_ball_objs[PW_NUM_BALLS];
+static uint8_t pw_grid[(PW_NUM_CELLS + 7) / 8];  /* Cell ownership bitmap: 0=team1, 1=team2 */
+static lv_obj_t *pw_arena = NULL;  /* Custom-drawn arena */
 static lv_obj_t *pw_score_label1 = NULL;  /* Team1 score */
 static lv_obj_t *pw_score_label2 = NULL;  /* Team2 score */
 static bool pw_initialized = false;
 static uint32_t pw_rand_seed = 12345;
 static int16_t pw_base_speed = 25;  /* Random base speed */
+static uint32_t pw_saved_refr_period = 0;  /* Display refresh period before Pong Wars */
 
-/* Ball state - pixel coordinates with fixed-point velocity */
+/* Ball state - fixed-point position, velocity in 1/10 px per 33ms frame */
 struct pw_ball {
-    int16_t x, y;      /* Pixel position */
-    int16_t dx, dy;    /* Velocity (pixels * 10 for precision) */
+    int16_t x, y;      /* Position (px * PW_SUBPX) */
+    int16_t dx, dy;    /* Velocity (px * PW_SUBPX per PW_BASE_FRAME_MS) */
     uint8_t team;
 };
 static struct pw_ball pw_balls[PW_NUM_BALLS];
 static int pw_score1 = 0, pw_score2 = 0;
 
+/* Frame statistics (LVGL thread only) */
+struct pw_frame_stats {
+    uint32_t start_ms;
+    uint32_t steps;
+    uint32_t step_us_max;
+    uint64_t step_us_total;
+    uint32_t renders;         /* Display refreshes that drew something */
+    uint32_t render_us_max;
+    uint64_t render_us_total;
+    uint64_t dirty_px;        /* Pixels invalidated by the game */
+};
+static struct pw_frame_stats pw_stats;
+static uint32_t pw_refr_start_cyc;
+static bool pw_refr_rendering;
+static bool pw_refr_hook_registered = false;
+
 /* Forward declarations */
 static void pw_tap_handler(lv_event_t *e);
 static void pw_reset_game(void);
@@ -3295,21 +3591,44 @@ static uint32_t pw_rand(void) {
     return (pw_rand_seed >> 16) & 0x7FFF;
 }
 
-/* Initialize grid data and update cell colors */
+static inline uint8_t pw_cell_team(int idx) {
+    return (pw_grid[idx >> 3] >> (idx & 7)) & 1;
+}
+
+static inline void pw_cell_set_team(int idx, uint8_t team) {
+    if (team) {
+        pw_grid[idx >> 3] |= BIT(idx & 7);
+    } else {
+        pw_grid[idx >> 3] &= ~BIT(idx & 7);
+    }
+}
+
+/* Invalidate an arena-relative rectangle */
+static void pw_invalidate(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    if (!pw_arena) return;
+
+    lv_area_t a;
+    lv_obj_get_coords(pw_arena, &a);
+    lv_area_t dirty = {a.x1 + x1, a.y1 + y1, a.x1 + x2, a.y1 + y2};
+    lv_obj_invalidate_area(pw_arena, &dirty);
+    pw_stats.dirty_px += lv_area_get_size(&dirty);
+}
+
+static void pw_invalidate_cell(int gx, int gy) {
+    pw_invalidate(gx * PW_CELL_SIZE, gy * PW_CELL_SIZE,
+                  (gx + 1) * PW_CELL_SIZE - 1, (gy + 1) * PW_CELL_SIZE - 1);
+}
+
+/* Initialize grid data */
 static void pw_init_grid(void) {
     pw_score1 = 0;
     pw_score2 = 0;
     for (int y = 0; y < PW_GRID_H; y++) {
         for (int x = 0; x < PW_GRID_W; x++) {
             int idx = y * PW_GRID_W + x;
-            pw_grid[idx] = (x < PW_GRID_W / 2) ? 0 : 1;
-            if (pw_grid[idx] == 0) pw_score1++; else pw_score2++;
-
-            /* Update pre-allocated cell color */
-            if (pw_cell_objs[idx]) {
-                uint32_t color = (pw_grid[idx] == 0) ? pw_color_team1 : pw_color_team2;
-                lv_obj_set_style_bg_color(pw_cell_objs[idx], lv_color_hex(color), 0);
-            }
+            uint8_t team = (x < PW_GRID_W / 2) ? 0 : 1;
+            pw_cell_set_team(idx, team);
+            if (team == 0) pw_score1++; else pw_score2++;
         }
     }
 }
@@ -3339,11 +3658,11 @@ static void pw_init_balls(void) {
 
         /* Start position: team 0 on left, team 1 on right */
         if (i == 0) {
-            pw_balls[i].x = PW_ARENA_W / 4;
-            pw_balls[i].y = PW_ARENA_H / 2;
+            pw_balls[i].x = PW_ARENA_W / 4 * PW_SUBPX;
+            pw_balls[i].y = PW_ARENA_H / 2 * PW_SUBPX;
         } else {
-            pw_balls[i].x = PW_ARENA_W * 3 / 4;
-            pw_balls[i].y = PW_ARENA_H / 2;
+            pw_balls[i].x = PW_ARENA_W * 3 / 4 * PW_SUBPX;
+            pw_balls[i].y = PW_ARENA_H / 2 * PW_SUBPX;
         }
 
         /* Random velocity with random base speed */
@@ -3365,68 +3684,145 @@ static void pw_init_balls(void) {
     }
 }
 
-/* Update cell color (no object creation/deletion!) */
-static void pw_update_cell_color(int gx, int gy, uint8_t team) {
-    int idx = gy * PW_GRID_W + gx;
-    if (idx < 0 || idx >= PW_NUM_CELLS) return;
-    if (!pw_cell_objs[idx]) return;
-
-    uint32_t color = (team == 0) ? pw_color_team1 : pw_color_team2;
-    lv_obj_set_style_bg_color(pw_cell_objs[idx], lv_color_hex(color), 0);
+static void pw_update_score(void) {
+    ui_bind_label_fmt(pw_score_label1, "%d", pw_score1);
+    ui_bind_label_fmt(pw_score_label2, "%d", pw_score2);
 }
 
-static void pw_update_ball_display(int i) {
-    if (!pw_ball_objs[i]) return;
-    lv_obj_set_pos(pw_ball_objs[i], pw_balls[i].x - PW_BALL_RADIUS, pw_balls[i].y - PW_BALL_RADIUS);
+/* Fill one arena rectangle; corner cells keep the arena's rounded corner */
+static void pw_draw_fill(lv_layer_t *layer, const lv_area_t *area, uint32_t color, bool corner) {
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(color);
+    dsc.bg_opa = LV_OPA_COVER;
+    dsc.radius = corner ? PW_RADIUS : 0;
+    lv_draw_rect(layer, &dsc, area);
 }
 
-static void pw_update_score(void) {
-    char buf[8];
-    if (pw_score_label1) {
-        snprintf(buf, sizeof(buf), "%d", pw_score1);
-        lv_label_set_text(pw_score_label1, buf);
-    }
-    if (pw_score_label2) {
-        snprintf(buf, sizeof(buf), "%d", pw_score2);
-        lv_label_set_text(pw_score_label2, buf);
+static void pw_arena_draw_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+
+    /*
+     * Cells: one rectangle per run of equal cells in a row. The four
+     * corner cells are drawn rounded and then squared off toward the
+     * inside, which replaces the clip_corner layer the old container used.
+     */
+    for (int y = 0; y < PW_GRID_H; y++) {
+        bool edge_row = (y == 0 || y == PW_GRID_H - 1);
+        int x = 0;
+        while (x < PW_GRID_W) {
+            uint8_t team = pw_cell_team(y * PW_GRID_W + x);
+            uint32_t color = team ? pw_color_team2 : pw_color_team1;
+            int run_end = x + 1;
+
+            if (!(edge_row && x == 0)) {
+                int limit = edge_row ? PW_GRID_W - 1 : PW_GRID_W;
+                while (run_end < limit && pw_cell_team(y * PW_GRID_W + run_end) == team) {
+                    run_end++;
+                }
+            }
+
+            lv_area_t cell = {
+                a.x1 + x * PW_CELL_SIZE, a.y1 + y * PW_CELL_SIZE,
+                a.x1 + run_end * PW_CELL_SIZE - 1, a.y1 + (y + 1) * PW_CELL_SIZE - 1,
+            };
+            bool corner = edge_row && (x == 0 || x == PW_GRID_W - 1);
+            pw_draw_fill(layer, &cell, color, corner);
+            if (corner) {
+                int32_t half = PW_CELL_SIZE / 2;
+                lv_area_t h = cell, v = cell;
+                if (x == 0) h.x1 += half; else h.x2 -= half;
+                if (y == 0) v.y1 += half; else v.y2 -= half;
+                pw_draw_fill(layer, &h, color, false);
+                pw_draw_fill(layer, &v, color, false);
+            }
+            x = run_end;
+        }
     }
+
+    /* Balls */
+    const uint32_t ball_colors[PW_NUM_BALLS] = {pw_color_ball1, pw_color_ball2};
+    for (int i = 0; i < PW_NUM_BALLS; i++) {
+        int32_t bx = a.x1 + pw_balls[i].x / PW_SUBPX;
+        int32_t by = a.y1 + pw_balls[i].y / PW_SUBPX;
+        lv_area_t ball = {bx - PW_BALL_RADIUS, by - PW_BALL_RADIUS,
+                          bx + PW_BALL_RADIUS - 1, by + PW_BALL_RADIUS - 1};
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+        dsc.bg_color = lv_color_hex(ball_colors[pw_balls[i].team]);
+        dsc.bg_opa = LV_OPA_COVER;
+        dsc.radius = LV_RADIUS_CIRCLE;
+        dsc.border_color = lv_color_white();
+        dsc.border_width = 2;
+        dsc.border_opa = LV_OPA_COVER;
+        lv_draw_rect(layer, &dsc, &ball);
+    }
+
+    /* Border on top of the cells */
+    lv_draw_rect_dsc_t border;
+    lv_draw_rect_dsc_init(&border);
+    border.bg_opa = LV_OPA_TRANSP;
+    border.radius = PW_RADIUS;
+    border.border_color = lv_color_hex(0x404060);
+    border.border_width = PW_BORDER;
+    border.border_opa = LV_OPA_COVER;
+    lv_draw_rect(layer, &border, &a);
+}
+
+/* Ball bounding box (arena coordinates) */
+static void pw_ball_box(const struct pw_ball *b, lv_area_t *box) {
+    int32_t bx = b->x / PW_SUBPX;
+    int32_t by = b->y / PW_SUBPX;
+    box->x1 = bx - PW_BALL_RADIUS;
+    box->y1 = by - PW_BALL_RADIUS;
+    box->x2 = bx + PW_BALL_RADIUS - 1;
+    box->y2 = by + PW_BALL_RADIUS - 1;
 }
 
 static void pw_step(void) {
     if (!pw_initialized) return;
 
+    const int min_pos = PW_BALL_RADIUS * PW_SUBPX;
+    const int max_x = (PW_ARENA_W - PW_BALL_RADIUS) * PW_SUBPX;
+    const int max_y = (PW_ARENA_H - PW_BALL_RADIUS) * PW_SUBPX;
+
     for (int i = 0; i < PW_NUM_BALLS; i++) {
         struct pw_ball *b = &pw_balls[i];
+        lv_area_t old_box;
+        pw_ball_box(b, &old_box);
 
-        /* Move ball (velocity is *10, so divide by 10) */
-        int new_x = b->x + b->dx / 10;
-        int new_y = b->y + b->dy / 10;
+        /* Same speed in px/s at any frame rate */
+        int new_x = b->x + b->dx * PW_FRAME_MS / PW_BASE_FRAME_MS;
+        int new_y = b->y + b->dy * PW_FRAME_MS / PW_BASE_FRAME_MS;
 
         /* Bounce off walls */
-        if (new_x < PW_BALL_RADIUS) {
-            new_x = PW_BALL_RADIUS;
+        if (new_x < min_pos) {
+            new_x = min_pos;
             b->dx = -b->dx;
-        } else if (new_x > PW_ARENA_W - PW_BALL_RADIUS) {
-            new_x = PW_ARENA_W - PW_BALL_RADIUS;
+        } else if (new_x > max_x) {
+            new_x = max_x;
             b->dx = -b->dx;
         }
-        if (new_y < PW_BALL_RADIUS) {
-            new_y = PW_BALL_RADIUS;
+        if (new_y < min_pos) {
+            new_y = min_pos;
             b->dy = -b->dy;
-        } else if (new_y > PW_ARENA_H - PW_BALL_RADIUS) {
-            new_y = PW_ARENA_H - PW_BALL_RADIUS;
+        } else if (new_y > max_y) {
+            new_y = max_y;
             b->dy = -b->dy;
         }
 
         /* Check which grid cell we're in */
-        int gx = new_x / PW_CELL_SIZE;
-        int gy = new_y / PW_CELL_SIZE;
+        int gx = new_x / PW_SUBPX / PW_CELL_SIZE;
+        int gy = new_y / PW_SUBPX / PW_CELL_SIZE;
         if (gx >= 0 && gx < PW_GRID_W && gy >= 0 && gy < PW_GRID_H) {
             int idx = gy * PW_GRID_W + gx;
-            if (pw_grid[idx] != b->team) {
-                /* Convert cell! (just update color, no object creation) */
-                pw_grid[idx] = b->team;
-                pw_update_cell_color(gx, gy, b->team);
+            if (pw_cell_team(idx) != b->team) {
+                /* Convert cell: flip one bit and redraw its rectangle */
+                pw_cell_set_team(idx, b->team);
+                pw_invalidate_cell(gx, gy);
                 if (b->team == 0) { pw_score1++; pw_score2--; }
                 else { pw_score2++; pw_score1--; }
 
@@ -3440,7 +3836,14 @@ static void pw_step(void) {
 
         b->x = new_x;
         b->y = new_y;
-        pw_update_ball_display(i);
+
+        /* Old and new position overlap - one rectangle covers both */
+        lv_area_t new_box;
+        pw_ball_box(b, &new_box);
+        if (new_box.x1 != old_box.x1 || new_box.y1 != old_box.y1) {
+            pw_invalidate(MIN(old_box.x1, new_box.x1), MIN(old_box.y1, new_box.y1),
+                          MAX(old_box.x2, new_box.x2), MAX(old_box.y2, new_box.y2));
+        }
     }
 }
 
@@ -3452,25 +3855,107 @@ static void pw_timer_cb(lv_timer_t *timer) {
     static uint16_t frame_count = 0;
     frame_count++;
 
-    /* Run physics (no object creation, just color updates) */
+    uint32_t start = k_cycle_get_32();
     pw_step();
+    uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    pw_stats.steps++;
+    pw_stats.step_us_total += us;
+    pw_stats.step_us_max = MAX(pw_stats.step_us_max, us);
 
-    /* Update score every ~10 frames */
-    if (frame_count % 10 == 0) {
+    /* Update score ~6 times per second */
+    if (frame_count % (CONFIG_PROSPECTOR_PONG_FPS / 6 + 1) == 0) {
         pw_update_score();
     }
 }
 
+/* Render time of display refreshes while the game runs */
+static void pw_refr_event_cb(lv_event_t *e) {
+    if (!pw_initialized || !pong_wars_active) {
+        return;
+    }
+
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        pw_refr_start_cyc = k_cycle_get_32();
+        pw_refr_rendering = false;
+        break;
+    case LV_EVENT_RENDER_START:
+        pw_refr_rendering = true;
+        break;
+    case LV_EVENT_REFR_READY:
+        if (pw_refr_rendering) {
+            uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - pw_refr_start_cyc);
+            pw_stats.renders++;
+            pw_stats.render_us_total += us;
+            pw_stats.render_us_max = MAX(pw_stats.render_us_max, us);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void pw_stats_reset(void) {
+    memset(&pw_stats, 0, sizeof(pw_stats));
+    pw_stats.start_ms = k_uptime_get_32();
+}
+
+static void pw_log_stats(void) {
+    uint32_t elapsed_ms = k_uptime_get_32() - pw_stats.start_ms;
+    if (elapsed_ms == 0 || pw_stats.steps == 0) {
+        return;
+    }
+    LOG_INF("Pong Wars: %u frames in %u ms, %u rendered fps, step %u us, render %u us (avg)",
+            pw_stats.steps, elapsed_ms, pw_stats.renders * 1000U / elapsed_ms,
+            (uint32_t)(pw_stats.step_us_total / pw_stats.steps),
+            pw_stats.renders ? (uint32_t)(pw_stats.render_us_total / pw_stats.renders) : 0);
+}
+
+/*
+ * The display refresh timer caps the frame rate (LV_DEF_REFR_PERIOD);
+ * run it at the game rate only while Pong Wars is on screen. With the
+ * refresh governor the period is requested from it instead.
+ */
+static void pw_set_fast_refresh(bool fast) {
+    lv_display_t *disp = lv_display_get_default();
+    lv_timer_t *refr = disp ? lv_display_get_refr_timer(disp) : NULL;
+    if (!refr) {
+        return;
+    }
+
+    if (fast && !pw_refr_hook_registered) {
+        lv_display_add_event_cb(disp, pw_refr_event_cb, LV_EVENT_REFR_START, NULL);
+        lv_display_add_event_cb(disp, pw_refr_event_cb, LV_EVENT_RENDER_START, NULL);
+        lv_display_add_event_cb(disp, pw_refr_event_cb, LV_EVENT_REFR_READY, NULL);
+        pw_refr_hook_registered = true;
+    }
+
+    if (IS_ENABLED(CONFIG_PROSPECTOR_REFRESH_GOVERNOR)) {
+        display_sched_request_period(fast ? PW_FRAME_MS : 0);
+        return;
+    }
+
+    if (fast) {
+        if (!pw_saved_refr_period) {
+            pw_saved_refr_period = lv_timer_get_period(refr);
+        }
+        lv_timer_set_period(refr, MIN(pw_saved_refr_period, PW_FRAME_MS));
+    } else if (pw_saved_refr_period) {
+        lv_timer_set_period(refr, pw_saved_refr_period);
+        pw_saved_refr_period = 0;
+    }
+}
+
 static void destroy_pong_wars_widgets(void) {
     /* CRITICAL: Resume background display updates */
     pong_wars_active = false;
 
+    pw_log_stats();
+    pw_set_fast_refresh(false);
     pw_initialized = false;
     if (pw_timer) { lv_timer_del(pw_timer); pw_timer = NULL; }
-    /* Cell objects will be cleaned by lv_obj_clean(screen_obj) in swipe handler */
-    memset(pw_cell_objs, 0, sizeof(pw_cell_objs));
-    memset(pw_ball_objs, 0, sizeof(pw_ball_objs));
-    pw_arena_container = NULL;
+    /* Objects are deleted with the screen container (screen_drop) */
+    pw_arena = NULL;
     pw_score_label1 = NULL;
     pw_score_label2 = NULL;
     LOG_INF("Pong Wars destroyed");
@@ -3482,8 +3967,19 @@ static void pw_tap_handler(lv_event_t *e) {
     pw_reset_game();
 }
 
+static void pw_apply_score_colors(void) {
+    if (pw_score_label1) {
+        lv_obj_set_style_text_color(pw_score_label1, lv_color_hex(pw_color_ball1), 0);
+        lv_obj_set_style_bg_color(pw_score_label1, lv_color_hex(pw_color_team1), 0);
+    }
+    if (pw_score_label2) {
+        lv_obj_set_style_text_color(pw_score_label2, lv_color_hex(pw_color_ball2), 0);
+        lv_obj_set_style_bg_color(pw_score_label2, lv_color_hex(pw_color_team2), 0);
+    }
+}
+
 static void create_pong_wars_widgets(void) {
-    LOG_INF("Creating Pong Wars (smooth version)...");
+    LOG_INF("Creating Pong Wars (canvas version)...");
 
     pw_initialized = false;
     pw_init_grid();
@@ -3506,8 +4002,6 @@ static void create_pong_wars_widgets(void) {
     pw_score_label1 = lv_label_create(screen_obj);
     if (pw_score_label1) {
         lv_obj_set_style_text_font(pw_score_label1, &lv_font_montserrat_12, 0);
-        lv_obj_set_style_text_color(pw_score_label1, lv_color_hex(pw_color_ball1), 0);
-        lv_obj_set_style_bg_color(pw_score_label1, lv_color_hex(pw_color_team1), 0);
         lv_obj_set_style_bg_opa(pw_score_label1, LV_OPA_COVER, 0);
         lv_obj_set_style_pad_hor(pw_score_label1, 8, 0);
         lv_obj_set_style_pad_ver(pw_score_label1, 2, 0);
@@ -3518,8 +4012,6 @@ static void create_pong_wars_widgets(void) {
     pw_score_label2 = lv_label_create(screen_obj);
     if (pw_score_label2) {
         lv_obj_set_style_text_font(pw_score_label2, &lv_font_montserrat_12, 0);
-        lv_obj_set_style_text_color(pw_score_label2, lv_color_hex(pw_color_ball2), 0);
-        lv_obj_set_style_bg_color(pw_score_label2, lv_color_hex(pw_color_team2), 0);
         lv_obj_set_style_bg_opa(pw_score_label2, LV_OPA_COVER, 0);
         lv_obj_set_style_pad_hor(pw_score_label2, 8, 0);
         lv_obj_set_style_pad_ver(pw_score_label2, 2, 0);
@@ -3527,62 +4019,19 @@ static void create_pong_wars_widgets(void) {
         /* Right-align to arena right edge (arena ends at x=260, label ~30px wide) */
         lv_obj_set_pos(pw_score_label2, PW_OFFSET_X + PW_ARENA_W - 35, 6);
     }
+    pw_apply_score_colors();
 
-    /* Arena container with rounded border */
-    pw_arena_container = lv_obj_create(screen_obj);
-    if (pw_arena_container) {
-        lv_obj_remove_style_all(pw_arena_container);
-        lv_obj_set_size(pw_arena_container, PW_ARENA_W, PW_ARENA_H);
-        lv_obj_set_pos(pw_arena_container, PW_OFFSET_X, PW_OFFSET_Y);
-        lv_obj_set_style_radius(pw_arena_container, 8, 0);
-        lv_obj_set_style_clip_corner(pw_arena_container, true, 0);
-        lv_obj_set_style_border_color(pw_arena_container, lv_color_hex(0x404060), 0);
-        lv_obj_set_style_border_width(pw_arena_container, 2, 0);
-        lv_obj_clear_flag(pw_arena_container, LV_OBJ_FLAG_SCROLLABLE);
+    /* Arena: a plain object painted entirely by pw_arena_draw_cb */
+    pw_arena = lv_obj_create(screen_obj);
+    if (pw_arena) {
+        lv_obj_remove_style_all(pw_arena);
+        lv_obj_set_size(pw_arena, PW_ARENA_W, PW_ARENA_H);
+        lv_obj_set_pos(pw_arena, PW_OFFSET_X, PW_OFFSET_Y);
+        lv_obj_clear_flag(pw_arena, LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_event_cb(pw_arena, pw_arena_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
         /* Add tap handler for reset */
-        lv_obj_add_flag(pw_arena_container, LV_OBJ_FLAG_CLICKABLE);
-        lv_obj_add_event_cb(pw_arena_container, pw_tap_handler, LV_EVENT_CLICKED, NULL);
-    }
-
-    /* Pre-allocate ALL cell objects (no dynamic alloc during game!) */
-    for (int y = 0; y < PW_GRID_H; y++) {
-        for (int x = 0; x < PW_GRID_W; x++) {
-            int idx = y * PW_GRID_W + x;
-            lv_obj_t *cell = lv_obj_create(pw_arena_container);
-            if (!cell) continue;
-
-            lv_obj_remove_style_all(cell);
-            lv_obj_set_size(cell, PW_CELL_SIZE, PW_CELL_SIZE);
-            lv_obj_set_pos(cell, x * PW_CELL_SIZE, y * PW_CELL_SIZE);
-
-            /* Initial color based on grid position */
-            uint32_t color = (x < PW_GRID_W / 2) ? pw_color_team1 : pw_color_team2;
-            lv_obj_set_style_bg_color(cell, lv_color_hex(color), 0);
-            lv_obj_set_style_bg_opa(cell, LV_OPA_COVER, 0);
-            lv_obj_clear_flag(cell, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-            pw_cell_objs[idx] = cell;
-        }
-    }
-    LOG_INF("Pre-allocated %d cell objects", PW_NUM_CELLS);
-
-    /* Create balls inside arena (using dynamic colors) */
-    lv_color_t ball_colors[2] = {lv_color_hex(pw_color_ball1), lv_color_hex(pw_color_ball2)};
-    for (int i = 0; i < PW_NUM_BALLS; i++) {
-        lv_obj_t *ball = lv_obj_create(pw_arena_container);
-        if (!ball) continue;
-        lv_obj_remove_style_all(ball);
-        lv_obj_set_size(ball, PW_BALL_RADIUS * 2, PW_BALL_RADIUS * 2);
-        lv_obj_set_style_bg_color(ball, ball_colors[pw_balls[i].team], 0);
-        lv_obj_set_style_bg_opa(ball, LV_OPA_COVER, 0);
-        lv_obj_set_style_radius(ball, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_border_color(ball, lv_color_white(), 0);
-        lv_obj_set_style_border_width(ball, 2, 0);
-        lv_obj_set_style_shadow_color(ball, lv_color_hex(0x000000), 0);
-        lv_obj_set_style_shadow_width(ball, 4, 0);
-        lv_obj_set_style_shadow_opa(ball, LV_OPA_50, 0);
-        lv_obj_clear_flag(ball, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-        pw_ball_objs[i] = ball;
-        pw_update_ball_display(i);
+        lv_obj_add_flag(pw_arena, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_event_cb(pw_arena, pw_tap_handler, LV_EVENT_CLICKED, NULL);
     }
 
     pw_update_score();
@@ -3601,67 +4050,62 @@ static void create_pong_wars_widgets(void) {
     /* CRITICAL: Stop background display updates to prevent thread conflicts */
     pong_wars_active = true;
 
-    /* High framerate for smooth animation (30 FPS) */
-    pw_timer = lv_timer_create(pw_timer_cb, 33, NULL);  /* 30 FPS */
-    LOG_INF("Pong Wars started! (smooth mode, background updates paused)");
+    pw_stats_reset();
+    pw_set_fast_refresh(true);
+    pw_timer = lv_timer_create(pw_timer_cb, PW_FRAME_MS, NULL);
+    LOG_INF("Pong Wars started! (%d FPS, background updates paused)", CONFIG_PROSPECTOR_PONG_FPS);
 }
 
-/* Reset game with new random colors and speed (pre-allocated cells version) */
+/* Reset game with new random colors and speed */
 static void pw_reset_game(void) {
     if (!pw_initialized) return;
-    if (!pw_arena_container) return;
-
-    /* Stop timer during reset */
-    pw_initialized = false;
-    if (pw_timer) {
-        lv_timer_del(pw_timer);
-        pw_timer = NULL;
-    }
+    if (!pw_arena) return;
 
     /* Reinitialize grid and balls with new random colors/speed */
     pw_init_grid();
     pw_init_balls();
 
-    /* Update ALL pre-allocated cell colors to match new grid state */
-    for (int y = 0; y < PW_GRID_H; y++) {
-        for (int x = 0; x < PW_GRID_W; x++) {
-            int idx = y * PW_GRID_W + x;
-            if (pw_cell_objs[idx]) {
-                uint32_t color = (pw_grid[idx] == 0) ? pw_color_team1 : pw_color_team2;
-                lv_obj_set_style_bg_color(pw_cell_objs[idx], lv_color_hex(color), 0);
-            }
-        }
-    }
-
-    /* Update ball colors and positions (balls already exist) */
-    lv_color_t ball_colors[2] = {lv_color_hex(pw_color_ball1), lv_color_hex(pw_color_ball2)};
-    for (int i = 0; i < PW_NUM_BALLS; i++) {
-        if (pw_ball_objs[i]) {
-            lv_obj_set_style_bg_color(pw_ball_objs[i], ball_colors[pw_balls[i].team], 0);
-            /* Move balls to foreground */
-            lv_obj_move_foreground(pw_ball_objs[i]);
-            pw_update_ball_display(i);
-        }
-    }
-
-    /* Update score labels with new colors */
-    if (pw_score_label1) {
-        lv_obj_set_style_text_color(pw_score_label1, lv_color_hex(pw_color_ball1), 0);
-        lv_obj_set_style_bg_color(pw_score_label1, lv_color_hex(pw_color_team1), 0);
-    }
-    if (pw_score_label2) {
-        lv_obj_set_style_text_color(pw_score_label2, lv_color_hex(pw_color_ball2), 0);
-        lv_obj_set_style_bg_color(pw_score_label2, lv_color_hex(pw_color_team2), 0);
-    }
-
+    pw_apply_score_colors();
     pw_update_score();
-
-    /* Restart timer */
-    pw_initialized = true;
-    pw_timer = lv_timer_create(pw_timer_cb, 33, NULL);  /* 30 FPS */
+    lv_obj_invalidate(pw_arena);
     LOG_INF("Pong Wars reset! (new colors/speed)");
 }
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+/* Shell runs outside the LVGL thread: counters are read without locking */
+static int cmd_pong(const struct shell *sh, size_t argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        pw_stats_reset();
+        shell_print(sh, "Pong Wars stats reset");
+        return 0;
+    }
+
+    struct pw_frame_stats st = pw_stats;
+    uint32_t elapsed_ms = k_uptime_get_32() - st.start_ms;
+    if (st.steps == 0 || elapsed_ms == 0) {
+        shell_print(sh, "No Pong Wars frames yet (swipe left from the main screen)");
+        return 0;
+    }
+
+    shell_print(sh, "Target: %d fps (%d ms), %s", CONFIG_PROSPECTOR_PONG_FPS, PW_FRAME_MS,
+                pw_initialized ? "running" : "stopped");
+    shell_print(sh, "Steps:  %u in %u ms = %u fps, avg %u us, max %u us", st.steps, elapsed_ms,
+                st.steps * 1000U / elapsed_ms, (uint32_t)(st.step_us_total / st.steps),
+                st.step_us_max);
+    shell_print(sh, "Render: %u frames = %u fps, avg %u us, max %u us", st.renders,
+                st.renders * 1000U / elapsed_ms,
+                st.renders ? (uint32_t)(st.render_us_total / st.renders) : 0,
+                st.render_us_max);
+    shell_print(sh, "Dirty:  %u px/frame (screen %u px)",
+                (uint32_t)(st.dirty_px / st.steps), 280U * 240U);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), pong, NULL, "Pong Wars frame statistics [reset]", cmd_pong, 1, 1);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
+
 /* ========== Swipe Processing (runs in LVGL timer = Main Thread) ========== */
 
 #if IS_ENABLED(CONFIG_PROSPECTOR_TOUCH_ENABLED)
@@ -3685,6 +4129,371 @@ static void ensure_lvgl_indev_registered(void) {
 static inline void ensure_lvgl_indev_registered(void) {}
 #endif
 
+/* ========== Screen Cache (screens built once, hidden/shown on swipe) ========== */
+
+/*
+ * Each screen lives in its own full-screen container on root_screen.
+ * Leaving a screen hides its container instead of deleting it when the
+ * RAM budget allows, so returning is a flag change plus one redraw
+ * instead of hundreds of allocations. The main screen is always kept;
+ * the other screens share CONFIG_PROSPECTOR_SCREEN_CACHE_BUDGET bytes of
+ * LVGL heap while hidden. With the cache disabled every screen is freed
+ * when left, as before.
+ */
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCREEN_CACHE)
+#define SCREEN_CACHE_BUDGET CONFIG_PROSPECTOR_SCREEN_CACHE_BUDGET
+#else
+#define SCREEN_CACHE_BUDGET 0
+#endif
+
+/* Per-object estimate when LVGL heap statistics are not available */
+#define SCREEN_CACHE_OBJ_BYTES 160
+
+struct screen_def {
+    const char *name;
+    void (*create)(void);   /* Build widgets on screen_obj */
+    void (*destroy)(void);  /* Release timers/pointers; the container is deleted after */
+    void (*show)(void);     /* Optional: back from the cache */
+    void (*hide)(void);     /* Optional: leaving, container kept or deleted after */
+    uint32_t bg_color;
+    bool needs_indev;       /* Has touch widgets */
+};
+
+struct screen_transition_stat {
+    uint32_t count;
+    uint32_t cache_hits;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+};
+
+/* LVGL heap used by the built screen. Seeded with generous per-object
+ * estimates so the first build can already make room; each build
+ * replaces the seed with the measured cost. */
+static uint32_t screen_cost[SCREEN_COUNT] = {
+    [SCREEN_MAIN] = 80 * SCREEN_CACHE_OBJ_BYTES,
+    [SCREEN_DISPLAY_SETTINGS] = 32 * SCREEN_CACHE_OBJ_BYTES,
+    [SCREEN_SYSTEM_SETTINGS] = 32 * SCREEN_CACHE_OBJ_BYTES,
+    [SCREEN_KEYBOARD_SELECT] = 40 * SCREEN_CACHE_OBJ_BYTES,
+    [SCREEN_PONG_WARS] = 128 * SCREEN_CACHE_OBJ_BYTES,  /* One object per cell */
+};
+static struct screen_transition_stat screen_transitions[SCREEN_COUNT][SCREEN_COUNT];
+static void main_screen_show(void) {
+    /* Widgets were skipped if the user swiped away right after boot */
+    main_build_deferred();
+    /* Updates queued while hidden are applied on the next timer pass */
+    if (pending_update_timer) {
+        lv_timer_ready(pending_update_timer);
+    }
+}
+
+static void ss_screen_show(void) {
+#if IS_ENABLED(CONFIG_PROSPECTOR_PERF_OVERLAY)
+    ss_perf_btn_update();  /* The overlay may have been toggled from the shell */
+#endif
+}
+
+static void ks_screen_show(void) {
+    ks_selected_keyboard = scanner_get_selected_keyboard();
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+    ks_follow_switches = scanner_get_auto_follow_switches();
+#endif
+    ks_update_channel_display();
+    ks_update_entries();
+    if (ks_update_timer) {
+        lv_timer_resume(ks_update_timer);
+    }
+}
+
+static void ks_screen_hide(void) {
+    ks_close_channel_popup();
+    if (ks_update_timer) {
+        lv_timer_pause(ks_update_timer);
+    }
+}
+
+static void pw_screen_show(void) {
+    pong_wars_active = true;
+    pw_set_fast_refresh(true);
+    if (pw_timer) {
+        lv_timer_resume(pw_timer);
+    }
+}
+
+static void pw_screen_hide(void) {
+    pong_wars_active = false;
+    pw_set_fast_refresh(false);
+    if (pw_timer) {
+        lv_timer_pause(pw_timer);
+    }
+}
+
+static const struct screen_def screen_defs[SCREEN_COUNT] = {
+    [SCREEN_MAIN] = {"main", create_main_screen_widgets, destroy_main_screen_widgets,
+                     main_screen_show, NULL, 0x000000, false},
+    [SCREEN_DISPLAY_SETTINGS] = {"display", create_display_settings_widgets,
+                                 destroy_display_settings_widgets, NULL, NULL, 0x0A0A0A, true},
+    [SCREEN_SYSTEM_SETTINGS] = {"system", create_system_settings_widgets,
+                                destroy_system_settings_widgets, ss_screen_show, NULL, 0x0A0A0A,
+                                true},
+    [SCREEN_KEYBOARD_SELECT] = {"keyboards", create_keyboard_select_widgets,
+                                destroy_keyboard_select_widgets, ks_screen_show, ks_screen_hide,
+                                0x0A0A0A, true},
+    [SCREEN_PONG_WARS] = {"pong", create_pong_wars_widgets, destroy_pong_wars_widgets,
+                          pw_screen_show, pw_screen_hide, 0x000000, true},
+};
+
+/* LVGL heap in use, or 0 if the pool does not report statistics */
+static uint32_t screen_cache_heap_used(void) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+    return stats.allocated_bytes;
+#else
+    return 0;
+#endif
+}
+
+static uint32_t screen_cache_heap_free(void) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+    return stats.free_bytes;
+#else
+    return UINT32_MAX;
+#endif
+}
+
+static uint32_t screen_count_objs(lv_obj_t *obj) {
+    uint32_t n = 1;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        n += screen_count_objs(lv_obj_get_child(obj, i));
+    }
+    return n;
+}
+
+/* Bytes held by hidden non-main screens, excluding one screen */
+static uint32_t screen_cache_hidden_bytes(enum screen_state except) {
+    uint32_t total = 0;
+    for (int i = SCREEN_MAIN + 1; i < SCREEN_COUNT; i++) {
+        if (i != except && screen_containers[i]) {
+            total += screen_cost[i];
+        }
+    }
+    return total;
+}
+
+static void screen_drop(enum screen_state screen) {
+    if (!screen_containers[screen]) {
+        return;
+    }
+    screen_defs[screen].destroy();
+    lv_obj_del(screen_containers[screen]);
+    screen_containers[screen] = NULL;
+    if (screen == SCREEN_MAIN) {
+        main_built_max_layers = 0;
+    }
+    LOG_DBG("Screen cache: dropped %s", screen_defs[screen].name);
+}
+
+static bool screen_should_retain(enum screen_state screen) {
+    if (!IS_ENABLED(CONFIG_PROSPECTOR_SCREEN_CACHE)) {
+        return false;
+    }
+    if (screen == SCREEN_MAIN) {
+        return true;
+    }
+    return screen_cache_hidden_bytes(screen) + screen_cost[screen] <= SCREEN_CACHE_BUDGET;
+}
+
+/* Evict hidden screens (main last) until a build of `need` bytes fits */
+static void screen_cache_make_room(uint32_t need) {
+    for (int i = SCREEN_COUNT - 1; i >= SCREEN_MAIN && screen_cache_heap_free() < need; i--) {
+        if (i != current_screen && screen_containers[i]) {
+            screen_drop(i);
+        }
+    }
+}
+
+static void screen_build(enum screen_state screen) {
+    screen_cache_make_room(screen_cost[screen]);
+
+    uint32_t before = screen_cache_heap_used();
+    screen_obj = screen_container_create(screen, screen_defs[screen].bg_color);
+    screen_defs[screen].create();
+    uint32_t after = screen_cache_heap_used();
+
+    screen_cost[screen] = (after > before) ? after - before
+                                           : screen_count_objs(screen_obj) * SCREEN_CACHE_OBJ_BYTES;
+    if (screen == SCREEN_MAIN) {
+        main_built_slide_mode = ds_layer_slide_mode;
+        main_built_max_layers = ds_max_layers;
+    }
+    LOG_DBG("Screen cache: built %s (%u bytes)", screen_defs[screen].name, screen_cost[screen]);
+}
+
+/* Hide (retain) or free the current screen, show or build the target.
+ * @return true if the target came from the cache */
+static bool screen_show(enum screen_state to, bool retain_from) {
+    enum screen_state from = current_screen;
+
+    if (screen_defs[from].hide) {
+        screen_defs[from].hide();
+    }
+    if (retain_from) {
+        lv_obj_add_flag(screen_containers[from], LV_OBJ_FLAG_HIDDEN);
+    } else {
+        screen_drop(from);
+    }
+
+    /* Layer layout settings changed on the settings screen - rebuild main */
+    if (to == SCREEN_MAIN && screen_containers[SCREEN_MAIN] &&
+        (main_built_slide_mode != ds_layer_slide_mode || main_built_max_layers != ds_max_layers)) {
+        screen_drop(SCREEN_MAIN);
+    }
+
+    bool hit = (screen_containers[to] != NULL);
+    current_screen = to;
+    /* Only the dashboard dims; settings must be readable while used */
+    panel_idle_set_suspended(to != SCREEN_MAIN);
+    if (hit) {
+        screen_obj = screen_containers[to];
+        lv_obj_clear_flag(screen_obj, LV_OBJ_FLAG_HIDDEN);
+        if (screen_defs[to].show) {
+            screen_defs[to].show();
+        }
+    } else {
+        screen_build(to);
+    }
+    if (screen_defs[to].needs_indev) {
+        ensure_lvgl_indev_registered();
+    }
+    return hit;
+}
+
+/* Switch screens on a swipe, timed into the transition statistics */
+static void screen_switch(enum screen_state to) {
+    enum screen_state from = current_screen;
+    uint32_t start = k_cycle_get_32();
+    bool hit = screen_show(to, screen_should_retain(from));
+
+    /* Stable frame: render and flush the new screen before measuring */
+    lv_refr_now(NULL);
+
+    uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+    struct screen_transition_stat *st = &screen_transitions[from][to];
+    st->count++;
+    st->cache_hits += hit ? 1 : 0;
+    st->last_us = us;
+    st->max_us = MAX(st->max_us, us);
+    st->total_us += us;
+
+    LOG_INF(">>> %s -> %s: %u.%03u ms (%s)", screen_defs[from].name, screen_defs[to].name,
+            us / 1000, us % 1000, hit ? "cached" : "built");
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static int cmd_screens(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    shell_print(sh, "Cache: %s, budget %u bytes, hidden %u bytes",
+                IS_ENABLED(CONFIG_PROSPECTOR_SCREEN_CACHE) ? "on" : "off",
+                SCREEN_CACHE_BUDGET, screen_cache_hidden_bytes(SCREEN_COUNT));
+    for (int i = 0; i < SCREEN_COUNT; i++) {
+        shell_print(sh, "  %-10s %-8s %6u bytes", screen_defs[i].name,
+                    !screen_containers[i] ? "-" : (i == current_screen ? "shown" : "hidden"),
+                    screen_cost[i]);
+    }
+
+    shell_print(sh, "%-10s %-10s %6s %5s %9s %9s %9s", "from", "to", "count", "hits",
+                "last(ms)", "avg(ms)", "max(ms)");
+    for (int f = 0; f < SCREEN_COUNT; f++) {
+        for (int t = 0; t < SCREEN_COUNT; t++) {
+            const struct screen_transition_stat *st = &screen_transitions[f][t];
+            if (st->count == 0) {
+                continue;
+            }
+            uint32_t avg = (uint32_t)(st->total_us / st->count);
+            shell_print(sh, "%-10s %-10s %6u %5u %5u.%03u %5u.%03u %5u.%03u",
+                        screen_defs[f].name, screen_defs[t].name, st->count, st->cache_hits,
+                        st->last_us / 1000, st->last_us % 1000, avg / 1000, avg % 1000,
+                        st->max_us / 1000, st->max_us % 1000);
+        }
+    }
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), screens, NULL, "Screen cache and swipe transition times",
+                 cmd_screens, 1, 0);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_RENDER_BENCH)
+
+/*
+ * Screens for "prospector rbench". Each scene is built fresh with the
+ * screen cache emptied, so the LVGL heap figure is that screen's own
+ * cost, and switches bypass screen_switch() to keep them out of the
+ * "prospector screens" transition statistics. Slide mode rebuilds main
+ * with the dial.
+ */
+static enum screen_state bench_saved_screen;
+static bool bench_saved_slide_mode;
+
+static void bench_show(enum screen_state to) {
+    screen_show(to, false);  /* Frees the current screen, builds the target */
+}
+
+static void bench_scene_main(void) {
+    ds_layer_slide_mode = false;
+    bench_show(SCREEN_MAIN);
+}
+
+static void bench_scene_slide(void) {
+    ds_layer_slide_mode = true;
+    bench_show(SCREEN_MAIN);
+}
+
+static void bench_scene_keyboards(void) { bench_show(SCREEN_KEYBOARD_SELECT); }
+
+static void bench_scene_pong(void) { bench_show(SCREEN_PONG_WARS); }
+
+static void bench_begin_end(bool begin) {
+    if (begin) {
+        bench_saved_screen = current_screen;
+        bench_saved_slide_mode = ds_layer_slide_mode;
+        for (int i = 0; i < SCREEN_COUNT; i++) {
+            if (i != current_screen) {
+                screen_drop(i);
+            }
+        }
+        return;
+    }
+    ds_layer_slide_mode = bench_saved_slide_mode;
+    bench_show(bench_saved_screen);  /* The cache refills on later swipes */
+}
+
+static const struct render_bench_scene bench_scenes[] = {
+    {"main", bench_scene_main},
+    {"slide", bench_scene_slide},
+    {"keyboards", bench_scene_keyboards},
+    {"pong", bench_scene_pong},
+};
+
+static void render_bench_scenes_register(void) {
+    render_bench_register(bench_scenes, ARRAY_SIZE(bench_scenes), bench_begin_end);
+}
+
+#else
+
+static void render_bench_scenes_register(void) {}
+
+#endif /* CONFIG_PROSPECTOR_RENDER_BENCH */
+
 /**
  * Process pending swipe in main thread context (LVGL timer callback)
  * This ensures all LVGL operations are thread-safe.
@@ -3708,6 +4517,7 @@ static void swipe_process_timer_cb(lv_timer_t *timer) {
 
     /* Check for pending swipe */
     enum swipe_direction dir = pending_swipe;
+    ui_wake_count_run(UI_WAKE_SWIPE, dir == SWIPE_DIRECTION_NONE);
     if (dir == SWIPE_DIRECTION_NONE) {
         return;  /* No pending swipe */
     }
@@ -3737,72 +4547,27 @@ static void swipe_process_timer_cb(lv_timer_t *timer) {
     case SWIPE_DIRECTION_DOWN:
         /* Main → Display Settings OR Keyboard Select → Main */
         if (current_screen == SCREEN_MAIN) {
-            LOG_INF(">>> Transitioning: MAIN -> DISPLAY_SETTINGS");
-            destroy_main_screen_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_hex(0x0A0A0A), 0);
-            lv_obj_invalidate(screen_obj);
-            create_display_settings_widgets();
-            ensure_lvgl_indev_registered();  /* Register for slider/switch touch */
-            current_screen = SCREEN_DISPLAY_SETTINGS;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_DISPLAY_SETTINGS);
         } else if (current_screen == SCREEN_KEYBOARD_SELECT) {
-            LOG_INF(">>> Transitioning: KEYBOARD_SELECT -> MAIN");
-            destroy_keyboard_select_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_black(), 0);
-            lv_obj_invalidate(screen_obj);
-            create_main_screen_widgets();
-            current_screen = SCREEN_MAIN;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_MAIN);
         }
         break;
 
     case SWIPE_DIRECTION_UP:
         /* Display Settings → Main OR Main → Keyboard Select */
         if (current_screen == SCREEN_DISPLAY_SETTINGS) {
-            LOG_INF(">>> Transitioning: DISPLAY_SETTINGS -> MAIN");
-            destroy_display_settings_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_black(), 0);
-            lv_obj_invalidate(screen_obj);
-            create_main_screen_widgets();
-            current_screen = SCREEN_MAIN;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_MAIN);
         } else if (current_screen == SCREEN_MAIN) {
-            LOG_INF(">>> Transitioning: MAIN -> KEYBOARD_SELECT");
-            destroy_main_screen_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_hex(0x0A0A0A), 0);
-            lv_obj_invalidate(screen_obj);
-            create_keyboard_select_widgets();
-            ensure_lvgl_indev_registered();  /* Register for keyboard entry touch */
-            current_screen = SCREEN_KEYBOARD_SELECT;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_KEYBOARD_SELECT);
         }
         break;
 
     case SWIPE_DIRECTION_LEFT:
         /* Main → Pong Wars OR Quick Actions → Main */
         if (current_screen == SCREEN_MAIN) {
-            LOG_INF(">>> Transitioning: MAIN -> PONG_WARS");
-            destroy_main_screen_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_black(), 0);
-            lv_obj_invalidate(screen_obj);
-            create_pong_wars_widgets();
-            ensure_lvgl_indev_registered();  /* Register for tap-to-reset */
-            current_screen = SCREEN_PONG_WARS;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_PONG_WARS);
         } else if (current_screen == SCREEN_SYSTEM_SETTINGS) {
-            LOG_INF(">>> Transitioning: QUICK_ACTIONS -> MAIN");
-            destroy_system_settings_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_black(), 0);
-            lv_obj_invalidate(screen_obj);
-            create_main_screen_widgets();
-            current_screen = SCREEN_MAIN;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_MAIN);
         } else if (current_screen == SCREEN_KEYBOARD_SELECT) {
             /* Channel decrement on left swipe */
             ks_close_channel_popup();  /* Close popup if open */
@@ -3814,24 +4579,9 @@ static void swipe_process_timer_cb(lv_timer_t *timer) {
     case SWIPE_DIRECTION_RIGHT:
         /* Pong Wars → Main OR Main → Quick Actions */
         if (current_screen == SCREEN_PONG_WARS) {
-            LOG_INF(">>> Transitioning: PONG_WARS -> MAIN");
-            destroy_pong_wars_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_black(), 0);
-            lv_obj_invalidate(screen_obj);
-            create_main_screen_widgets();
-            current_screen = SCREEN_MAIN;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_MAIN);
         } else if (current_screen == SCREEN_MAIN) {
-            LOG_INF(">>> Transitioning: MAIN -> QUICK_ACTIONS");
-            destroy_main_screen_widgets();
-            lv_obj_clean(screen_obj);
-            lv_obj_set_style_bg_color(screen_obj, lv_color_hex(0x0A0A0A), 0);
-            lv_obj_invalidate(screen_obj);
-            create_system_settings_widgets();
-            ensure_lvgl_indev_registered();  /* Register for button touch */
-            current_screen = SCREEN_SYSTEM_SETTINGS;
-            LOG_INF(">>> Transition complete");
+            screen_switch(SCREEN_SYSTEM_SETTINGS);
         } else if (current_screen == SCREEN_KEYBOARD_SELECT) {
             /* Channel increment on right swipe */
             ks_close_channel_popup();  /* Close popup if open */
@@ -3874,6 +4624,7 @@ static int swipe_gesture_listener(const zmk_event_t *eh) {
 
     /* Just set the flag - processing happens in LVGL timer (main thread) */
     pending_swipe = ev->direction;
+    ui_wake(UI_WAKE_SWIPE);
 
     return ZMK_EV_EVENT_BUBBLE;
 }
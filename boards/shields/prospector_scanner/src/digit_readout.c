@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Digit atlas readout (see digit_readout.h)
+ *
+ * Atlases are rasterized on first use with LVGL's own label renderer into
+ * a canvas, so they are pixel-identical to a label of the same font. They
+ * live in a static pool and are never freed; the status screen uses only
+ * a couple of font/color combinations.
+ *
+ * "prospector digits bench [n]" times set + refresh of an LVGL label
+ * against a readout showing the same values. The run happens in the LVGL
+ * thread (paused timer woken by the shell) on the top layer.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "digit_readout.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(digit_readout, LOG_LEVEL_INF);
+
+#define ATLAS_CHARS     "0123456789-.%"
+#define ATLAS_NUM_CHARS (sizeof(ATLAS_CHARS) - 1)
+#define ATLAS_MAX       4
+
+struct digit_atlas {
+    const lv_font_t *font;
+    lv_color_t fg;
+    lv_color_t bg;
+    int32_t cell_w;
+    int32_t cell_h;
+    uint8_t *buf;
+    lv_image_dsc_t glyph[ATLAS_NUM_CHARS];  /* Slices of buf, one per character */
+};
+
+struct digit_readout {
+    const struct digit_atlas *atlas;
+    lv_text_align_t align;
+    uint8_t len;
+    char text[DIGIT_READOUT_MAX_CHARS + 1];
+};
+
+static struct digit_atlas atlases[ATLAS_MAX];
+static int atlas_count = 0;
+static uint8_t atlas_pool[CONFIG_PROSPECTOR_DIGIT_ATLAS_POOL_SIZE] __aligned(4);
+static size_t atlas_pool_used = 0;
+
+static void bench_timer_cb(lv_timer_t *timer);
+static lv_timer_t *bench_timer = NULL;
+
+static const struct digit_atlas *atlas_get(const lv_font_t *font, lv_color_t fg, lv_color_t bg) {
+    for (int i = 0; i < atlas_count; i++) {
+        if (atlases[i].font == font && lv_color_eq(atlases[i].fg, fg) &&
+            lv_color_eq(atlases[i].bg, bg)) {
+            return &atlases[i];
+        }
+    }
+    if (atlas_count >= ATLAS_MAX) {
+        return NULL;
+    }
+
+    int32_t cell_w = 0;
+    for (size_t i = 0; i < ATLAS_NUM_CHARS; i++) {
+        cell_w = MAX(cell_w, (int32_t)lv_font_get_glyph_width(font, ATLAS_CHARS[i], 0));
+    }
+    int32_t cell_h = lv_font_get_line_height(font);
+    int32_t atlas_w = cell_w * ATLAS_NUM_CHARS;
+    uint32_t stride = lv_draw_buf_width_to_stride(atlas_w, LV_COLOR_FORMAT_RGB565);
+    size_t size = ROUND_UP(stride * cell_h, 4);
+
+    if (atlas_pool_used + size > sizeof(atlas_pool)) {
+        LOG_WRN("Digit atlas pool full (%u + %u > %u bytes)", atlas_pool_used, size,
+                sizeof(atlas_pool));
+        return NULL;
+    }
+
+    struct digit_atlas *atlas = &atlases[atlas_count];
+    atlas->font = font;
+    atlas->fg = fg;
+    atlas->bg = bg;
+    atlas->cell_w = cell_w;
+    atlas->cell_h = cell_h;
+    atlas->buf = &atlas_pool[atlas_pool_used];
+
+    /* Rasterize with the label renderer into a temporary canvas */
+    lv_obj_t *canvas = lv_canvas_create(NULL);
+    if (!canvas) {
+        return NULL;
+    }
+    lv_canvas_set_buffer(canvas, atlas->buf, atlas_w, cell_h, LV_COLOR_FORMAT_RGB565);
+    lv_canvas_fill_bg(canvas, bg, LV_OPA_COVER);
+
+    static const char *const char_str[ATLAS_NUM_CHARS] = {
+        "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "-", ".", "%",
+    };
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    for (size_t i = 0; i < ATLAS_NUM_CHARS; i++) {
+        lv_draw_label_dsc_t dsc;
+        lv_draw_label_dsc_init(&dsc);
+        dsc.font = font;
+        dsc.color = fg;
+        dsc.align = LV_TEXT_ALIGN_CENTER;
+        dsc.text = char_str[i];
+        lv_area_t cell = {i * cell_w, 0, (i + 1) * cell_w - 1, cell_h - 1};
+        lv_draw_label(&layer, &dsc, &cell);
+    }
+    lv_canvas_finish_layer(canvas, &layer);
+    lv_obj_del(canvas);
+
+    for (size_t i = 0; i < ATLAS_NUM_CHARS; i++) {
+        lv_image_dsc_t *img = &atlas->glyph[i];
+        memset(img, 0, sizeof(*img));
+        img->header.magic = LV_IMAGE_HEADER_MAGIC;
+        img->header.cf = LV_COLOR_FORMAT_RGB565;
+        img->header.w = cell_w;
+        img->header.h = cell_h;
+        img->header.stride = stride;
+        img->data = atlas->buf + i * cell_w * 2;
+        img->data_size = stride * (cell_h - 1) + cell_w * 2;
+    }
+
+    atlas_pool_used += size;
+    atlas_count++;
+    LOG_INF("Digit atlas %d: %dx%d cells, %u bytes (pool %u/%u)", atlas_count, cell_w, cell_h,
+            size, atlas_pool_used, sizeof(atlas_pool));
+    return atlas;
+}
+
+static int atlas_char_index(char c) {
+    const char *p = strchr(ATLAS_CHARS, c);
+    return (c && p) ? (int)(p - ATLAS_CHARS) : -1;
+}
+
+/* x offset of the first character inside the object */
+static int32_t readout_text_x(lv_obj_t *obj, const struct digit_readout *ro, uint8_t len) {
+    int32_t free_w = lv_obj_get_width(obj) - len * ro->atlas->cell_w;
+    switch (ro->align) {
+    case LV_TEXT_ALIGN_RIGHT:
+        return MAX(free_w, 0);
+    case LV_TEXT_ALIGN_LEFT:
+        return 0;
+    default:
+        return MAX(free_w / 2, 0);
+    }
+}
+
+static void readout_draw_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    struct digit_readout *ro = lv_obj_get_user_data(obj);
+    if (!ro) {
+        return;
+    }
+
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    int32_t x = a.x1 + readout_text_x(obj, ro, ro->len);
+    int32_t cell_w = ro->atlas->cell_w;
+
+    for (uint8_t i = 0; i < ro->len; i++, x += cell_w) {
+        int idx = atlas_char_index(ro->text[i]);
+        if (idx < 0) {
+            continue;  /* Space: background only */
+        }
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = &ro->atlas->glyph[idx];
+        lv_area_t cell = {x, a.y1, x + cell_w - 1, a.y1 + ro->atlas->cell_h - 1};
+        lv_draw_image(layer, &dsc, &cell);
+    }
+}
+
+static void readout_delete_cb(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target(e);
+    lv_free(lv_obj_get_user_data(obj));
+    lv_obj_set_user_data(obj, NULL);
+}
+
+static bool is_readout(lv_obj_t *obj) {
+    return obj && !lv_obj_check_type(obj, &lv_label_class) && lv_obj_get_user_data(obj);
+}
+
+lv_obj_t *digit_readout_create(lv_obj_t *parent, const lv_font_t *font, lv_color_t fg,
+                               lv_color_t bg, uint8_t max_chars) {
+    if (!bench_timer) {
+        bench_timer = lv_timer_create(bench_timer_cb, 0, NULL);
+        if (bench_timer) {
+            lv_timer_pause(bench_timer);
+        }
+    }
+
+    const struct digit_atlas *atlas = atlas_get(font, fg, bg);
+    struct digit_readout *ro = atlas ? lv_malloc_zeroed(sizeof(*ro)) : NULL;
+    if (!ro) {
+        lv_obj_t *label = lv_label_create(parent);
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_obj_set_style_text_color(label, fg, 0);
+        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+        lv_label_set_text(label, "");
+        return label;
+    }
+
+    ro->atlas = atlas;
+    ro->align = LV_TEXT_ALIGN_CENTER;
+
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, MIN(max_chars, DIGIT_READOUT_MAX_CHARS) * atlas->cell_w,
+                    atlas->cell_h);
+    lv_obj_set_style_bg_color(obj, bg, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_user_data(obj, ro);
+    lv_obj_add_event_cb(obj, readout_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(obj, readout_delete_cb, LV_EVENT_DELETE, NULL);
+    return obj;
+}
+
+void digit_readout_set_align(lv_obj_t *obj, lv_text_align_t align) {
+    if (!obj) {
+        return;
+    }
+    if (!is_readout(obj)) {
+        lv_obj_set_style_text_align(obj, align, 0);
+        return;
+    }
+    struct digit_readout *ro = lv_obj_get_user_data(obj);
+    if (ro->align != align) {
+        ro->align = align;
+        lv_obj_invalidate(obj);
+    }
+}
+
+bool digit_readout_set_text(lv_obj_t *obj, const char *text) {
+    if (!obj || !text) {
+        return false;
+    }
+    if (!is_readout(obj)) {
+        const char *cur = lv_label_get_text(obj);
+        if (cur && strcmp(cur, text) == 0) {
+            return false;
+        }
+        lv_label_set_text(obj, text);
+        return true;
+    }
+
+    struct digit_readout *ro = lv_obj_get_user_data(obj);
+    uint8_t len = MIN(strlen(text), DIGIT_READOUT_MAX_CHARS);
+    if (len == ro->len && strncmp(ro->text, text, len) == 0) {
+        return false;
+    }
+
+    if (len != ro->len) {
+        /* Layout moved - redraw the whole (fixed size) object */
+        lv_obj_invalidate(obj);
+    } else {
+        /* Same layout - redraw only the cells that changed */
+        lv_area_t a;
+        lv_obj_get_coords(obj, &a);
+        int32_t x = a.x1 + readout_text_x(obj, ro, len);
+        for (uint8_t i = 0; i < len; i++, x += ro->atlas->cell_w) {
+            if (ro->text[i] != text[i]) {
+                lv_area_t cell = {x, a.y1, x + ro->atlas->cell_w - 1, a.y2};
+                lv_obj_invalidate_area(obj, &cell);
+            }
+        }
+    }
+
+    memcpy(ro->text, text, len);
+    ro->text[len] = '\0';
+    ro->len = len;
+    return true;
+}
+
+bool digit_readout_set_int(lv_obj_t *obj, int32_t value) {
+    char buf[12];
+    snprintf(buf, sizeof(buf), "%d", value);
+    return digit_readout_set_text(obj, buf);
+}
+
+/* ========== Benchmark: LVGL label vs digit readout ========== */
+
+struct digit_bench_result {
+    uint16_t iterations;
+    uint32_t label_set_us;      /* Totals over all iterations */
+    uint32_t label_refr_us;
+    uint32_t readout_set_us;
+    uint32_t readout_refr_us;
+};
+
+static volatile uint16_t bench_request = 0;
+static struct digit_bench_result bench_result;
+
+static void bench_run(uint16_t n) {
+    lv_obj_t *top = lv_layer_top();
+    lv_obj_t *label = lv_label_create(top);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_16, 0);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_bg_color(label, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+    lv_obj_set_width(label, 48);
+    lv_obj_align(label, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+
+    lv_obj_t *ro = digit_readout_create(top, &lv_font_montserrat_16, lv_color_white(),
+                                        lv_color_black(), 3);
+    lv_obj_set_width(ro, 48);
+    lv_obj_align(ro, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    lv_obj_add_flag(ro, LV_OBJ_FLAG_HIDDEN);
+
+    struct digit_bench_result res = {.iterations = n};
+    lv_refr_now(NULL);  /* Flush anything pending before timing */
+
+    for (uint16_t i = 0; i < n; i++) {
+        uint32_t t0 = k_cycle_get_32();
+        lv_label_set_text_fmt(label, "%d", (i * 37) % 1000);
+        uint32_t t1 = k_cycle_get_32();
+        lv_refr_now(NULL);
+        uint32_t t2 = k_cycle_get_32();
+        res.label_set_us += k_cyc_to_us_floor32(t1 - t0);
+        res.label_refr_us += k_cyc_to_us_floor32(t2 - t1);
+    }
+
+    lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(ro, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(NULL);
+
+    for (uint16_t i = 0; i < n; i++) {
+        uint32_t t0 = k_cycle_get_32();
+        digit_readout_set_int(ro, (i * 37) % 1000);
+        uint32_t t1 = k_cycle_get_32();
+        lv_refr_now(NULL);
+        uint32_t t2 = k_cycle_get_32();
+        res.readout_set_us += k_cyc_to_us_floor32(t1 - t0);
+        res.readout_refr_us += k_cyc_to_us_floor32(t2 - t1);
+    }
+
+    lv_obj_del(label);
+    lv_obj_del(ro);
+    bench_result = res;
+
+    LOG_INF("Digit bench (%u updates): label %u+%u us, readout %u+%u us (set+refresh avg)", n,
+            res.label_set_us / n, res.label_refr_us / n, res.readout_set_us / n,
+            res.readout_refr_us / n);
+}
+
+static void bench_timer_cb(lv_timer_t *timer) {
+    lv_timer_pause(timer);
+    uint16_t n = bench_request;
+    bench_request = 0;
+    if (n > 0) {
+        bench_run(n);
+    }
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static int cmd_digits(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        if (!bench_timer) {
+            shell_error(sh, "No readout created yet");
+            return -ENODEV;
+        }
+        uint16_t n = (argc >= 3) ? CLAMP(atoi(argv[2]), 1, 1000) : 100;
+        bench_request = n;
+        /* Only clears the timer's paused flag; the run is in the LVGL thread */
+        lv_timer_resume(bench_timer);
+        shell_print(sh, "Benchmark of %u updates queued, run 'prospector digits' for results", n);
+        return 0;
+    }
+
+    shell_print(sh, "Atlases: %d/%d, pool %u/%u bytes", atlas_count, ATLAS_MAX, atlas_pool_used,
+                sizeof(atlas_pool));
+    for (int i = 0; i < atlas_count; i++) {
+        shell_print(sh, "  %d: %dx%d cells, fg %06X bg %06X", i, atlases[i].cell_w,
+                    atlases[i].cell_h, lv_color_to_u32(atlases[i].fg) & 0xFFFFFF,
+                    lv_color_to_u32(atlases[i].bg) & 0xFFFFFF);
+    }
+
+    struct digit_bench_result res = bench_result;
+    if (res.iterations == 0) {
+        shell_print(sh, "No benchmark yet ('prospector digits bench [n]')");
+        return 0;
+    }
+    uint16_t n = res.iterations;
+    shell_print(sh, "Benchmark, %u updates (avg us):   set  refresh", n);
+    shell_print(sh, "  LVGL label                  %6u  %7u", res.label_set_us / n,
+                res.label_refr_us / n);
+    shell_print(sh, "  digit readout               %6u  %7u", res.readout_set_us / n,
+                res.readout_refr_us / n);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), digits, NULL, "Digit atlas readouts [bench [n]]", cmd_digits, 1,
+                 2);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Numeric readout widget backed by a pre-rasterized digit atlas
+ *
+ * The characters "0123456789-.%" of a font are rendered once, per
+ * font/foreground/background combination, into an RGB565 atlas with one
+ * fixed-width cell per character. The readout draws each character as an
+ * image slice of that atlas, which the software renderer copies row by
+ * row without glyph decoding or alpha blending. Only the character cells
+ * that changed are invalidated.
+ *
+ * Characters are laid out at a fixed advance (tabular digits), so a value
+ * never shifts when it changes. Any other character is drawn as a space.
+ *
+ * LVGL thread only, like any other LVGL call.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+#define DIGIT_READOUT_MAX_CHARS 8
+
+/**
+ * @brief Create a readout sized for max_chars characters
+ *
+ * Falls back to a plain label (same font/colors) if the atlas pool is
+ * full, so callers never need to handle a NULL atlas. The setters below
+ * accept either object.
+ */
+lv_obj_t *digit_readout_create(lv_obj_t *parent, const lv_font_t *font, lv_color_t fg,
+                               lv_color_t bg, uint8_t max_chars);
+
+/** Horizontal alignment of the text inside the object (default center) */
+void digit_readout_set_align(lv_obj_t *obj, lv_text_align_t align);
+
+/** @return true if the text was changed */
+bool digit_readout_set_text(lv_obj_t *obj, const char *text);
+
+/** @return true if the text was changed */
+bool digit_readout_set_int(lv_obj_t *obj, int32_t value);
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Tickless LVGL scheduling (see display_sched.h)
+ *
+ * The tick work runs on ZMK's display work queue like ZMK's own display
+ * tick, so LVGL is still only ever entered from that thread. LVGL pauses
+ * its animation timer when no animation runs and its refresh timer once
+ * nothing is invalidated, so on a static dashboard the returned deadline
+ * is the next widget timer (or none) and the thread sleeps until then.
+ *
+ * Work done on the display queue outside lv_timer_handler() (ui_wake,
+ * ZMK display events) may invalidate areas or create timers. Invalidations
+ * are caught with the display's INVALIDATE_AREA event; anything else is
+ * picked up by the capped sleep.
+ *
+ * "prospector tick" prints display thread wakeups per second, handler
+ * time and, with CONFIG_SCHED_THREAD_USAGE_ALL, CPU idle percentage.
+ * "prospector tick fixed" runs the handler every DISPLAY_SCHED_FIXED_MS
+ * like ZMK's default tick for comparison.
+ *
+ * Refresh governor: LVGL's refresh timer period bounds how often
+ * invalidations become frames. While animations run (lv_anim count) or a
+ * screen holds a request (Pong Wars) it is set to the fast period; when
+ * static to the slow period, so bursts of widget updates coalesce into
+ * one frame and the thread wakes less. Both the animation timer and the
+ * refresh timer pause when idle, so a static screen costs no wakeups
+ * either way. The switch happens right after the handler run that started
+ * or finished the last animation. "prospector tick gov on|off" compares
+ * against LVGL's fixed LV_DEF_REFR_PERIOD; "prospector tick" shows the
+ * share of time spent fast next to the CPU idle figure.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#include "display_sched.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(display_sched, LOG_LEVEL_INF);
+
+/* ZMK's default CONFIG_ZMK_DISPLAY_TICK_PERIOD_MS */
+#define DISPLAY_SCHED_FIXED_MS 10
+
+struct display_sched_stats {
+    uint32_t runs;         /* lv_timer_handler() calls = display thread wakeups */
+    uint32_t kicks;        /* Runs requested by invalidations / ui_wake */
+    uint32_t capped;       /* Sleeps cut short by the max sleep */
+    uint32_t handler_us_max;
+    uint64_t handler_us_total;
+    uint64_t sleep_ms_total;
+    uint32_t start_ms;
+    uint32_t gov_switches;
+    uint64_t gov_fast_ms;  /* Time spent at the fast refresh period */
+#if IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)
+    k_thread_runtime_stats_t cpu_start;
+#endif
+};
+
+static void display_sched_tick(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(tick_work, display_sched_tick);
+
+static bool sched_started;
+static bool in_handler;  /* Invalidations from inside the handler need no kick */
+static bool sched_suspended;
+static volatile bool tickless = true;
+static struct display_sched_stats sched_stats;
+static uint64_t handler_us_lifetime;
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_REFRESH_GOVERNOR)
+#define GOV_FAST_MS CONFIG_PROSPECTOR_REFRESH_FAST_MS
+#define GOV_SLOW_MS CONFIG_PROSPECTOR_REFRESH_SLOW_MS
+#else
+#define GOV_FAST_MS LV_DEF_REFR_PERIOD
+#define GOV_SLOW_MS LV_DEF_REFR_PERIOD
+#endif
+
+static volatile bool gov_enabled = IS_ENABLED(CONFIG_PROSPECTOR_REFRESH_GOVERNOR);
+static uint32_t gov_request_ms;  /* display_sched_request_period(), 0 = none */
+static uint32_t gov_period_ms;   /* Refresh period currently applied */
+static bool gov_fast;
+static uint32_t gov_fast_since_ms;
+
+static void display_sched_reset_stats(void) {
+    memset(&sched_stats, 0, sizeof(sched_stats));
+    sched_stats.start_ms = k_uptime_get_32();
+    gov_fast_since_ms = sched_stats.start_ms;
+#if IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)
+    k_thread_runtime_stats_all_get(&sched_stats.cpu_start);
+#endif
+}
+
+static uint32_t display_sched_gov_period(bool *fast) {
+    uint32_t fast_ms = gov_request_ms ? MIN(gov_request_ms, GOV_FAST_MS) : GOV_FAST_MS;
+
+    if (!gov_enabled) {
+        *fast = gov_request_ms != 0;
+        return gov_request_ms ? MIN(gov_request_ms, LV_DEF_REFR_PERIOD) : LV_DEF_REFR_PERIOD;
+    }
+    *fast = gov_request_ms != 0 || lv_anim_count_running() > 0;
+    return *fast ? fast_ms : GOV_SLOW_MS;
+}
+
+/*
+ * LVGL thread: apply the refresh period for the current UI state.
+ * Returns true if the period changed.
+ */
+static bool display_sched_govern(void) {
+    if (!IS_ENABLED(CONFIG_PROSPECTOR_REFRESH_GOVERNOR)) {
+        return false;  /* Pong Wars sets the refresh period itself */
+    }
+
+    bool fast;
+    uint32_t period = display_sched_gov_period(&fast);
+    uint32_t now = k_uptime_get_32();
+
+    if (fast != gov_fast) {
+        if (gov_fast) {
+            sched_stats.gov_fast_ms += now - gov_fast_since_ms;
+        }
+        gov_fast = fast;
+        gov_fast_since_ms = now;
+        sched_stats.gov_switches++;
+    }
+
+    if (period == gov_period_ms) {
+        return false;
+    }
+
+    lv_display_t *disp = lv_display_get_default();
+    lv_timer_t *refr = disp ? lv_display_get_refr_timer(disp) : NULL;
+    if (!refr) {
+        return false;
+    }
+    lv_timer_set_period(refr, period);
+    gov_period_ms = period;
+    return true;
+}
+
+void display_sched_request_period(uint32_t period_ms) {
+    gov_request_ms = period_ms;
+    display_sched_govern();
+}
+
+static void display_sched_tick(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    uint32_t start = k_cycle_get_32();
+    in_handler = true;
+    uint32_t next_ms = lv_timer_handler();
+    in_handler = false;
+    uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+    /* A shorter refresh period may fall due before the returned deadline */
+    if (display_sched_govern()) {
+        next_ms = MIN(next_ms, gov_period_ms);
+    }
+
+    uint32_t sleep_ms;
+    if (!tickless) {
+        sleep_ms = DISPLAY_SCHED_FIXED_MS;
+    } else if (next_ms > CONFIG_PROSPECTOR_TICKLESS_MAX_SLEEP_MS) {
+        /* Also LV_NO_TIMER_READY: no timer is running at all */
+        sleep_ms = CONFIG_PROSPECTOR_TICKLESS_MAX_SLEEP_MS;
+        sched_stats.capped++;
+    } else {
+        sleep_ms = next_ms;
+    }
+
+    sched_stats.runs++;
+    sched_stats.handler_us_total += us;
+    sched_stats.handler_us_max = MAX(sched_stats.handler_us_max, us);
+    handler_us_lifetime += us;
+    sched_stats.sleep_ms_total += sleep_ms;
+
+    /* Replaces a kick queued while the handler ran */
+    if (!sched_suspended) {
+        k_work_reschedule_for_queue(zmk_display_work_q(), &tick_work, K_MSEC(sleep_ms));
+    }
+}
+
+void display_sched_kick(void) {
+    if (!sched_started || in_handler || sched_suspended) {
+        return;
+    }
+    sched_stats.kicks++;
+    k_work_reschedule_for_queue(zmk_display_work_q(), &tick_work, K_NO_WAIT);
+}
+
+void display_sched_set_suspended(bool suspended) {
+    sched_suspended = suspended;
+    if (suspended) {
+        k_work_cancel_delayable(&tick_work);
+    } else {
+        display_sched_kick();
+    }
+}
+
+uint64_t display_sched_handler_us(void) {
+    return handler_us_lifetime;
+}
+
+static void display_sched_invalidate_cb(lv_event_t *e) {
+    ARG_UNUSED(e);
+    display_sched_kick();
+}
+
+void display_sched_start(void) {
+    if (sched_started) {
+        return;
+    }
+
+    lv_display_t *disp = lv_display_get_default();
+    if (disp) {
+        lv_display_add_event_cb(disp, display_sched_invalidate_cb, LV_EVENT_INVALIDATE_AREA,
+                                NULL);
+    }
+
+    /* Animations step at the fast period; their timer pauses when none run */
+    if (IS_ENABLED(CONFIG_PROSPECTOR_REFRESH_GOVERNOR)) {
+        lv_timer_set_period(lv_anim_get_timer(), GOV_FAST_MS);
+    }
+
+    display_sched_reset_stats();
+    display_sched_govern();
+    sched_started = true;
+    k_work_reschedule_for_queue(zmk_display_work_q(), &tick_work, K_NO_WAIT);
+    LOG_INF("Tickless LVGL scheduling started (max sleep %d ms)",
+            CONFIG_PROSPECTOR_TICKLESS_MAX_SLEEP_MS);
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+/* Shell runs outside the LVGL thread: counters are read without locking */
+static int cmd_tick(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "gov") == 0 && argc >= 3) {
+            if (!IS_ENABLED(CONFIG_PROSPECTOR_REFRESH_GOVERNOR)) {
+                shell_error(sh, "Built without CONFIG_PROSPECTOR_REFRESH_GOVERNOR");
+                return -ENOTSUP;
+            }
+            /* Applied by the next handler run */
+            gov_enabled = strcmp(argv[2], "on") == 0;
+            display_sched_kick();
+        } else if (strcmp(argv[1], "fixed") == 0) {
+            tickless = false;
+        } else if (strcmp(argv[1], "tickless") == 0) {
+            tickless = true;
+        } else if (strcmp(argv[1], "reset") != 0) {
+            shell_error(sh, "Usage: prospector tick [tickless|fixed|reset|gov on|off]");
+            return -EINVAL;
+        }
+        display_sched_reset_stats();
+        shell_print(sh, "Display scheduling: %s, governor %s, counters reset",
+                    tickless ? "tickless" : "fixed", gov_enabled ? "on" : "off");
+        return 0;
+    }
+
+    struct display_sched_stats st = sched_stats;
+    uint32_t window_ms = MAX(k_uptime_get_32() - st.start_ms, 1);
+
+    shell_print(sh, "Display scheduling: %s (%s), over %u ms",
+                tickless ? "tickless" : "fixed", sched_started ? "running" : "not started",
+                window_ms);
+    shell_print(sh, "Wakeups: %u (%u.%02u/s), kicked %u, capped %u", st.runs,
+                st.runs * 1000U / window_ms, (st.runs * 100000U / window_ms) % 100, st.kicks,
+                st.capped);
+    if (st.runs) {
+        shell_print(sh, "Handler: avg %u us, max %u us, avg sleep %u ms",
+                    (uint32_t)(st.handler_us_total / st.runs), st.handler_us_max,
+                    (uint32_t)(st.sleep_ms_total / st.runs));
+    }
+
+    uint64_t fast_ms = st.gov_fast_ms + (gov_fast ? k_uptime_get_32() - gov_fast_since_ms : 0);
+    shell_print(sh, "Refresh governor: %s, period %u ms (fast %u / slow %u), fast %u%% of time, "
+                "%u switches",
+                gov_enabled ? "on" : "off", gov_period_ms, GOV_FAST_MS, GOV_SLOW_MS,
+                (uint32_t)(MIN(fast_ms, window_ms) * 100U / window_ms), st.gov_switches);
+
+#if IS_ENABLED(CONFIG_SCHED_THREAD_USAGE_ALL)
+    k_thread_runtime_stats_t now;
+    k_thread_runtime_stats_all_get(&now);
+    uint64_t exec = now.execution_cycles - st.cpu_start.execution_cycles;
+    uint64_t idle = now.idle_cycles - st.cpu_start.idle_cycles;
+    if (exec) {
+        uint32_t permille = (uint32_t)(idle * 1000U / exec);
+        shell_print(sh, "CPU idle: %u.%u%%", permille / 10, permille % 10);
+    }
+#else
+    shell_print(sh, "CPU idle: enable CONFIG_SCHED_THREAD_USAGE_ALL");
+#endif
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), tick, NULL, "LVGL scheduling [tickless|fixed|reset|gov on|off]",
+                 cmd_tick, 1, 2);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
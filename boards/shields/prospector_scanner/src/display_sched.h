@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Tickless LVGL scheduling on the display work queue
+ *
+ * lv_timer_handler() is run by one delayable work item that sleeps until
+ * the deadline LVGL returns (next timer, animation frame or refresh),
+ * capped by CONFIG_PROSPECTOR_TICKLESS_MAX_SLEEP_MS. Invalidations and
+ * ui_wake() signals reschedule it immediately. ZMK's fixed display tick
+ * is slowed down to a safety net (Kconfig.defconfig).
+ *
+ * With CONFIG_PROSPECTOR_REFRESH_GOVERNOR the display refresh period is
+ * chosen after every handler run: fast while an animation runs or a
+ * screen requested it (Pong Wars), slow while the UI is static.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_TICKLESS_DISPLAY)
+
+/**
+ * @brief Start scheduling LVGL
+ *
+ * LVGL thread, once the display and status screen exist.
+ */
+void display_sched_start(void);
+
+/**
+ * @brief Run lv_timer_handler() as soon as possible
+ *
+ * Any thread. Does nothing before display_sched_start().
+ */
+void display_sched_kick(void);
+
+/** Total time spent in lv_timer_handler() since boot (never reset) */
+uint64_t display_sched_handler_us(void);
+
+/**
+ * @brief Request a fast display refresh period
+ *
+ * LVGL thread. Holds the refresh period at or below period_ms until
+ * called with 0, also with the governor switched off at runtime.
+ */
+void display_sched_request_period(uint32_t period_ms);
+
+/**
+ * @brief Stop or restart scheduling LVGL (deep screen-off)
+ *
+ * LVGL thread. While suspended kicks are ignored; resuming kicks.
+ */
+void display_sched_set_suspended(bool suspended);
+
+#else
+
+static inline void display_sched_start(void) {}
+
+static inline void display_sched_kick(void) {}
+
+static inline uint64_t display_sched_handler_us(void) { return 0; }
+
+static inline void display_sched_request_period(uint32_t period_ms) { ARG_UNUSED(period_ms); }
+
+static inline void display_sched_set_suspended(bool suspended) { ARG_UNUSED(suspended); }
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Display / system settings persistence (see display_settings_store.h)
+ *
+ * Boot: the subtree is loaded in SYS_INIT before ZMK's display init, so
+ * the status screen is created with the restored values and the first
+ * frame already uses them. The channel is handed straight to the scanner.
+ * Runtime: the UI only copies values into a pending record; the save runs
+ * from the system work queue after CONFIG_PROSPECTOR_SETTINGS_STORE_DELAY_MS
+ * without further changes, so flash erase never blocks the LVGL thread and
+ * a slider drag costs one write. Unchanged values are not written.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <string.h>
+
+#include "display_settings_store.h"
+#include "boot_timing.h"
+
+LOG_MODULE_REGISTER(display_settings_store, LOG_LEVEL_INF);
+
+#define STORE_SUBTREE  "prospector/disp"
+#define STORE_VERSION  1
+
+/* Provided by system_settings_widget.c */
+extern void scanner_set_runtime_channel(uint8_t channel);
+
+/* Settings value: version byte + display settings */
+struct display_settings_record {
+    uint8_t version;
+    struct display_settings ds;
+} __packed;
+
+static struct k_spinlock store_lock;
+static struct display_settings_record pending_ds;
+static struct display_settings_record saved_ds;
+static bool pending_ds_valid = false;
+static bool restored_ds_valid = false;
+static uint8_t pending_channel;
+static bool pending_channel_valid = false;
+static int16_t saved_channel = -1;  /* -1 = nothing stored yet */
+static bool restoring = false;
+
+static void store_save_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(store_save_work, store_save_work_handler);
+
+static void store_save_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    struct display_settings_record ds;
+    bool ds_valid;
+    uint8_t channel;
+    bool channel_valid;
+
+    k_spinlock_key_t key = k_spin_lock(&store_lock);
+    ds = pending_ds;
+    ds_valid = pending_ds_valid;
+    channel = pending_channel;
+    channel_valid = pending_channel_valid;
+    pending_ds_valid = false;
+    pending_channel_valid = false;
+    k_spin_unlock(&store_lock, key);
+
+    if (ds_valid && memcmp(&ds, &saved_ds, sizeof(ds)) != 0) {
+        int err = settings_save_one(STORE_SUBTREE "/ds", &ds, sizeof(ds));
+        if (err) {
+            LOG_WRN("Saving display settings failed: %d", err);
+        } else {
+            saved_ds = ds;
+            LOG_INF("Display settings saved");
+        }
+    }
+
+    if (channel_valid && channel != saved_channel) {
+        int err = settings_save_one(STORE_SUBTREE "/ch", &channel, sizeof(channel));
+        if (err) {
+            LOG_WRN("Saving channel failed: %d", err);
+        } else {
+            saved_channel = channel;
+            LOG_INF("Scanner channel %d saved", channel);
+        }
+    }
+}
+
+void display_settings_store_save(const struct display_settings *settings) {
+    k_spinlock_key_t key = k_spin_lock(&store_lock);
+    pending_ds.version = STORE_VERSION;
+    pending_ds.ds = *settings;
+    pending_ds_valid = true;
+    k_spin_unlock(&store_lock, key);
+
+    /* Reschedule: the delay counts from the last change of a drag */
+    k_work_reschedule(&store_save_work, K_MSEC(CONFIG_PROSPECTOR_SETTINGS_STORE_DELAY_MS));
+}
+
+void display_settings_store_save_channel(uint8_t channel) {
+    if (restoring) {
+        return;  /* Echo of our own restore below */
+    }
+
+    k_spinlock_key_t key = k_spin_lock(&store_lock);
+    pending_channel = channel;
+    pending_channel_valid = true;
+    k_spin_unlock(&store_lock, key);
+
+    k_work_reschedule(&store_save_work, K_MSEC(CONFIG_PROSPECTOR_SETTINGS_STORE_DELAY_MS));
+}
+
+bool display_settings_store_get(struct display_settings *out) {
+    if (!restored_ds_valid) {
+        return false;
+    }
+    *out = saved_ds.ds;
+    return true;
+}
+
+static int store_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                              void *cb_arg) {
+    const char *next;
+
+    if (settings_name_steq(name, "ds", &next) && !next) {
+        struct display_settings_record rec;
+        if (len != sizeof(rec) || read_cb(cb_arg, &rec, sizeof(rec)) < 0 ||
+            rec.version != STORE_VERSION) {
+            /* Old layout - ignore, overwritten on next save */
+            return 0;
+        }
+        saved_ds = rec;
+        restored_ds_valid = true;
+        return 0;
+    }
+
+    if (settings_name_steq(name, "ch", &next) && !next) {
+        uint8_t channel;
+        if (len != sizeof(channel) || read_cb(cb_arg, &channel, sizeof(channel)) < 0) {
+            return -EINVAL;
+        }
+        saved_channel = channel;
+        restoring = true;
+        scanner_set_runtime_channel(channel);
+        restoring = false;
+        return 0;
+    }
+
+    return -ENOENT;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(prospector_disp, STORE_SUBTREE, NULL, store_settings_set, NULL,
+                               NULL);
+
+static int display_settings_store_init(void) {
+    int err = settings_subsys_init();
+    if (err) {
+        LOG_ERR("Settings init failed: %d", err);
+        return 0;
+    }
+
+    /* Load only our subtree now - the full settings_load() runs later */
+    settings_load_subtree(STORE_SUBTREE);
+    boot_timing_mark(BOOT_PHASE_SETTINGS_LOADED);
+    LOG_INF("Display settings %s", restored_ds_valid ? "restored" : "at defaults");
+    return 0;
+}
+
+/* Before ZMK display init (CONFIG_APPLICATION_INIT_PRIORITY) creates the screen */
+SYS_INIT(display_settings_store_init, APPLICATION, 85);
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Display / system settings persisted through Zephyr settings
+ * ("prospector/disp/ds" and "prospector/disp/ch").
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Display Settings screen values (layout is the stored format) */
+struct display_settings {
+    bool auto_brightness;
+    uint8_t manual_brightness;
+    bool battery_visible;
+    uint8_t max_layers;
+    bool layer_slide_mode;
+} __packed;
+
+/**
+ * @brief Get the settings restored at boot
+ *
+ * @return true if a stored record was found (out filled), false to keep defaults
+ */
+bool display_settings_store_get(struct display_settings *out);
+
+/**
+ * @brief Request a write-behind save of the display settings
+ *
+ * Only copies the values and (re)arms a delayed save, so it is safe to call
+ * on every slider VALUE_CHANGED from the LVGL thread: a drag becomes one
+ * flash write once the values have been stable for the save delay.
+ */
+void display_settings_store_save(const struct display_settings *settings);
+
+/**
+ * @brief Request a write-behind save of the scanner channel
+ */
+void display_settings_store_save_channel(uint8_t channel);
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Deep screen-off (see display_sleep.h)
+ *
+ * Enter, in the LVGL thread:
+ *   backlight off -> display_blanking_on() -> panel SUSPEND (SLEEP_IN)
+ *   -> invalidation off, all LVGL timers disabled, tickless scheduler
+ *   suspended -> SPI bus SUSPEND
+ *
+ * ZMK's display tick still calls lv_timer_handler() (1 s with the
+ * tickless scheduler), but it returns at once while timers are disabled:
+ * no screen timer, animation or display refresh runs, so nothing changes
+ * widgets, renders or touches the bus. Data that arrives meanwhile stays
+ * pending in scanner_stub.c and is applied by the first timer pass after
+ * waking. Wake requests from the scanner or the touch callback
+ * set an atomic flag and queue the wake work on the display work queue,
+ * which undoes the steps in reverse, invalidates the active screen and
+ * kicks the scheduler. The panel stays blanked until the first frame
+ * has been flushed, so no stale GRAM content is shown.
+ *
+ * Wake-to-first-frame is measured from the first wake request to
+ * REFR_READY of that frame and includes the panel's SLEEP_OUT delay
+ * (120 ms). "prospector sleep" prints it.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/pm/device.h>
+#include <zephyr/sys/atomic.h>
+#include <string.h>
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#include "display_sleep.h"
+#include "display_sched.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(display_sleep, LOG_LEVEL_INF);
+
+#define SLEEP_DISPLAY_NODE DT_CHOSEN(zephyr_display)
+
+/* Panel on a MIPI DBI node: the SPI bus is its spi-dev, else the parent */
+#if DT_NODE_HAS_COMPAT(DT_PARENT(SLEEP_DISPLAY_NODE), zephyr_mipi_dbi_spi)
+#define SLEEP_SPI_NODE DT_PHANDLE(DT_PARENT(SLEEP_DISPLAY_NODE), spi_dev)
+#else
+#define SLEEP_SPI_NODE DT_BUS(SLEEP_DISPLAY_NODE)
+#endif
+
+enum sleep_state {
+    SLEEP_AWAKE,
+    SLEEP_ASLEEP,
+    SLEEP_WAKING,  /* Resumed, waiting for the first frame */
+};
+
+struct display_sleep_stats {
+    uint32_t sleeps;
+    uint32_t wakes[DISPLAY_SLEEP_WAKE_COUNT];
+    uint32_t frames;  /* Wakes completed with a first frame */
+    uint32_t wake_ms_last;
+    uint32_t wake_ms_max;
+    uint64_t wake_ms_total;
+    uint64_t asleep_ms_total;
+};
+
+static const struct device *const sleep_display = DEVICE_DT_GET(SLEEP_DISPLAY_NODE);
+static const struct device *const sleep_spi = DEVICE_DT_GET(SLEEP_SPI_NODE);
+
+static display_sleep_backlight_cb_t sleep_backlight_cb;
+static atomic_t sleep_state = ATOMIC_INIT(SLEEP_AWAKE);
+static atomic_t wake_requested;
+static uint32_t wake_request_cyc;
+static uint32_t asleep_since_ms;
+static bool frame_rendered;
+static struct display_sleep_stats sleep_stats;
+
+static void display_sleep_wake_work_handler(struct k_work *work);
+static K_WORK_DEFINE(wake_work, display_sleep_wake_work_handler);
+
+static void display_sleep_pm(const struct device *dev, enum pm_device_action action) {
+#if IS_ENABLED(CONFIG_PM_DEVICE)
+    int ret = pm_device_action_run(dev, action);
+    if (ret < 0 && ret != -EALREADY && ret != -ENOTSUP) {
+        LOG_WRN("%s: PM action %d failed (%d)", dev->name, action, ret);
+    }
+#else
+    ARG_UNUSED(dev);
+    ARG_UNUSED(action);
+#endif
+}
+
+static void display_sleep_set_rendering(bool enabled) {
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp) {
+        return;
+    }
+
+    lv_display_enable_invalidation(disp, enabled);
+    /* Also stops animations (lv_anim runs on an LVGL timer) */
+    lv_timer_enable(enabled);
+}
+
+void display_sleep_enter(void) {
+    if (!atomic_cas(&sleep_state, SLEEP_AWAKE, SLEEP_ASLEEP)) {
+        return;
+    }
+
+    LOG_INF("No keyboards - display entering deep sleep");
+    if (sleep_backlight_cb) {
+        sleep_backlight_cb(true);
+    }
+    display_blanking_on(sleep_display);
+    display_sleep_pm(sleep_display, PM_DEVICE_ACTION_SUSPEND);
+
+    display_sleep_set_rendering(false);
+    display_sched_set_suspended(true);
+
+    display_sleep_pm(sleep_spi, PM_DEVICE_ACTION_SUSPEND);
+
+    sleep_stats.sleeps++;
+    asleep_since_ms = k_uptime_get_32();
+
+    /* A wake request may have raced the state change */
+    if (atomic_get(&wake_requested)) {
+        k_work_submit_to_queue(zmk_display_work_q(), &wake_work);
+    }
+}
+
+void display_sleep_wake(enum display_sleep_wake_source source) {
+    if (atomic_get(&sleep_state) != SLEEP_ASLEEP || source >= DISPLAY_SLEEP_WAKE_COUNT) {
+        return;
+    }
+    if (atomic_set(&wake_requested, 1) == 0) {
+        wake_request_cyc = k_cycle_get_32();
+        sleep_stats.wakes[source]++;
+    }
+    k_work_submit_to_queue(zmk_display_work_q(), &wake_work);
+}
+
+bool display_sleep_is_asleep(void) {
+    return atomic_get(&sleep_state) != SLEEP_AWAKE;
+}
+
+static void display_sleep_wake_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    if (!atomic_cas(&sleep_state, SLEEP_ASLEEP, SLEEP_WAKING)) {
+        return;
+    }
+
+    sleep_stats.asleep_ms_total += k_uptime_get_32() - asleep_since_ms;
+
+    display_sleep_pm(sleep_spi, PM_DEVICE_ACTION_RESUME);
+    display_sleep_pm(sleep_display, PM_DEVICE_ACTION_RESUME);
+
+    frame_rendered = false;
+    display_sleep_set_rendering(true);
+    lv_obj_invalidate(lv_screen_active());
+    display_sched_set_suspended(false);
+    LOG_INF("Display waking from deep sleep");
+}
+
+/* First frame after waking: unblank and restore the backlight */
+static void display_sleep_refr_cb(lv_event_t *e) {
+    if (atomic_get(&sleep_state) != SLEEP_WAKING) {
+        return;
+    }
+
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        frame_rendered = true;
+        return;
+    }
+    if (!frame_rendered) {
+        return;
+    }
+
+    uint32_t ms = k_cyc_to_ms_floor32(k_cycle_get_32() - wake_request_cyc);
+    sleep_stats.frames++;
+    sleep_stats.wake_ms_last = ms;
+    sleep_stats.wake_ms_max = MAX(sleep_stats.wake_ms_max, ms);
+    sleep_stats.wake_ms_total += ms;
+
+    atomic_set(&wake_requested, 0);
+    atomic_set(&sleep_state, SLEEP_AWAKE);
+
+    display_blanking_off(sleep_display);
+    if (sleep_backlight_cb) {
+        sleep_backlight_cb(false);
+    }
+    LOG_INF("Display awake, first frame after %u ms", ms);
+}
+
+void display_sleep_init(display_sleep_backlight_cb_t backlight_cb) {
+    sleep_backlight_cb = backlight_cb;
+
+    lv_display_t *disp = lv_display_get_default();
+    if (disp) {
+        lv_display_add_event_cb(disp, display_sleep_refr_cb, LV_EVENT_RENDER_START, NULL);
+        lv_display_add_event_cb(disp, display_sleep_refr_cb, LV_EVENT_REFR_READY, NULL);
+    }
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static void display_sleep_enter_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+    display_sleep_enter();
+}
+
+static K_WORK_DEFINE(enter_work, display_sleep_enter_work_handler);
+
+/* Shell runs outside the LVGL thread: counters are read without locking */
+static int cmd_sleep(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "enter") == 0) {
+            k_work_submit_to_queue(zmk_display_work_q(), &enter_work);
+        } else if (strcmp(argv[1], "wake") == 0) {
+            display_sleep_wake(DISPLAY_SLEEP_WAKE_SHELL);
+        } else if (strcmp(argv[1], "reset") == 0) {
+            memset(&sleep_stats, 0, sizeof(sleep_stats));
+        } else {
+            shell_error(sh, "Usage: prospector sleep [enter|wake|reset]");
+            return -EINVAL;
+        }
+        return 0;
+    }
+
+    static const char *const state_names[] = {"awake", "asleep", "waking"};
+    struct display_sleep_stats st = sleep_stats;
+
+    shell_print(sh, "Display: %s (PM %s), %u sleeps, asleep %u s total",
+                state_names[atomic_get(&sleep_state)],
+                IS_ENABLED(CONFIG_PM_DEVICE) ? "on" : "off - blanking only", st.sleeps,
+                (uint32_t)(st.asleep_ms_total / 1000));
+    shell_print(sh, "Wakes: keyboard %u, touch %u, shell %u",
+                st.wakes[DISPLAY_SLEEP_WAKE_KEYBOARD], st.wakes[DISPLAY_SLEEP_WAKE_TOUCH],
+                st.wakes[DISPLAY_SLEEP_WAKE_SHELL]);
+    if (st.frames) {
+        shell_print(sh, "Wake to first frame: last %u ms, avg %u ms, max %u ms", st.wake_ms_last,
+                    (uint32_t)(st.wake_ms_total / st.frames), st.wake_ms_max);
+    }
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), sleep, NULL, "Deep screen-off [enter|wake|reset]", cmd_sleep, 1,
+                 1);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Deep screen-off while no keyboard is present
+ *
+ * Instead of only dimming the backlight when every keyboard has timed
+ * out, the panel is blanked and put into SLEEP_IN, LVGL stops rendering
+ * and scheduling, and the SPI bus is suspended. The first keyboard
+ * packet or touch wakes it; the backlight comes back with the first
+ * rendered frame.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <zephyr/sys/util.h>
+
+enum display_sleep_wake_source {
+    DISPLAY_SLEEP_WAKE_KEYBOARD,
+    DISPLAY_SLEEP_WAKE_TOUCH,
+    DISPLAY_SLEEP_WAKE_SHELL,
+    DISPLAY_SLEEP_WAKE_COUNT,
+};
+
+/**
+ * @brief Backlight hook, LVGL thread
+ *
+ * Called with asleep = true before the panel is blanked and with
+ * asleep = false once the first frame after waking has been flushed.
+ */
+typedef void (*display_sleep_backlight_cb_t)(bool asleep);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_DEEP_SLEEP)
+
+/** LVGL thread, once the display and status screen exist */
+void display_sleep_init(display_sleep_backlight_cb_t backlight_cb);
+
+/** LVGL thread. Does nothing if already asleep. */
+void display_sleep_enter(void);
+
+/**
+ * @brief Wake the display
+ *
+ * Any thread. Cheap when awake, so it can be called per packet.
+ */
+void display_sleep_wake(enum display_sleep_wake_source source);
+
+bool display_sleep_is_asleep(void);
+
+#else
+
+static inline void display_sleep_init(display_sleep_backlight_cb_t backlight_cb) {
+    ARG_UNUSED(backlight_cb);
+}
+
+static inline void display_sleep_enter(void) {}
+
+static inline void display_sleep_wake(enum display_sleep_wake_source source) {
+    ARG_UNUSED(source);
+}
+
+static inline bool display_sleep_is_asleep(void) { return false; }
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Dirty-rectangle merging (see flush_opt.h)
+ *
+ * Runs on LV_EVENT_REFR_START, before LVGL joins its invalidated areas.
+ * LVGL's own join only merges areas whose bounding box is smaller than
+ * both together, which ignores the fixed cost of every flush area: the
+ * render pass, three commands with D/C toggles and the SPI transaction
+ * setup. Here two areas are merged when
+ *
+ *   cost(union) < cost(a) + cost(b),  cost(x) = overhead + bytes(x) * byte_ns
+ *
+ * byte_ns follows from the panel's mipi-max-frequency; the overhead is
+ * CONFIG_PROSPECTOR_FLUSH_OPT_OVERHEAD_US and can be tuned at runtime
+ * ("prospector flush overhead <us>") against "prospector fps". Merging
+ * repeats until no pair pays off; merged-away areas are marked joined so
+ * LVGL skips them.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lvgl.h>
+#include <src/display/lv_display_private.h>  /* inv_areas / inv_area_joined */
+
+#include "flush_opt.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(flush_opt, LOG_LEVEL_INF);
+
+#define FLUSH_OPT_DISPLAY DT_CHOSEN(zephyr_display)
+#define FLUSH_OPT_BPP (LV_COLOR_DEPTH / 8)
+
+#if DT_NODE_HAS_PROP(FLUSH_OPT_DISPLAY, mipi_max_frequency)
+#define FLUSH_OPT_SPI_HZ DT_PROP(FLUSH_OPT_DISPLAY, mipi_max_frequency)
+#elif DT_NODE_HAS_PROP(FLUSH_OPT_DISPLAY, spi_max_frequency)
+#define FLUSH_OPT_SPI_HZ DT_PROP(FLUSH_OPT_DISPLAY, spi_max_frequency)
+#else
+#define FLUSH_OPT_SPI_HZ 8000000
+#endif
+
+/* Nanoseconds per pixel byte on the wire */
+#define FLUSH_OPT_BYTE_NS (8U * 1000000000ULL / FLUSH_OPT_SPI_HZ)
+
+struct flush_opt_totals {
+    uint32_t frames;
+    uint32_t merges;
+    uint64_t areas_in;
+    uint64_t areas_out;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    uint64_t cost_us_in;
+    uint64_t cost_us_out;
+    uint32_t start_ms;
+};
+
+static bool opt_started;
+static volatile bool opt_enabled = true;
+static volatile uint32_t opt_overhead_us = CONFIG_PROSPECTOR_FLUSH_OPT_OVERHEAD_US;
+static struct flush_opt_frame last_frame;
+static struct flush_opt_totals totals;
+
+static uint32_t flush_opt_bytes(const lv_area_t *area) {
+    return lv_area_get_size(area) * FLUSH_OPT_BPP;
+}
+
+static uint32_t flush_opt_cost_us(const lv_area_t *area) {
+    return opt_overhead_us + (uint32_t)(flush_opt_bytes(area) * FLUSH_OPT_BYTE_NS / 1000U);
+}
+
+/* Sum bytes and modelled cost of the areas not yet joined */
+static uint16_t flush_opt_measure(lv_display_t *disp, uint32_t *bytes, uint32_t *cost_us) {
+    uint16_t count = 0;
+
+    *bytes = 0;
+    *cost_us = 0;
+    for (uint32_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) {
+            continue;
+        }
+        count++;
+        *bytes += flush_opt_bytes(&disp->inv_areas[i]);
+        *cost_us += flush_opt_cost_us(&disp->inv_areas[i]);
+    }
+    return count;
+}
+
+static void flush_opt_merge(lv_display_t *disp) {
+    bool merged;
+
+    do {
+        merged = false;
+        for (uint32_t i = 0; i < disp->inv_p; i++) {
+            if (disp->inv_area_joined[i]) {
+                continue;
+            }
+            for (uint32_t j = i + 1; j < disp->inv_p; j++) {
+                if (disp->inv_area_joined[j]) {
+                    continue;
+                }
+                lv_area_t joined;
+                lv_area_join(&joined, &disp->inv_areas[i], &disp->inv_areas[j]);
+                if (flush_opt_cost_us(&joined) >= flush_opt_cost_us(&disp->inv_areas[i]) +
+                                                       flush_opt_cost_us(&disp->inv_areas[j])) {
+                    continue;
+                }
+                lv_area_copy(&disp->inv_areas[i], &joined);
+                disp->inv_area_joined[j] = 1;
+                totals.merges++;
+                merged = true;
+            }
+        }
+    } while (merged);
+}
+
+static void flush_opt_refr_start_cb(lv_event_t *e) {
+    lv_display_t *disp = lv_event_get_target(e);
+    struct flush_opt_frame frame;
+
+    /* Nothing to merge; the full-screen invalidation also lands here */
+    if (disp->inv_p < 2) {
+        return;
+    }
+
+    frame.areas_in = flush_opt_measure(disp, &frame.bytes_in, &frame.cost_us_in);
+    if (opt_enabled) {
+        flush_opt_merge(disp);
+    }
+    frame.areas_out = flush_opt_measure(disp, &frame.bytes_out, &frame.cost_us_out);
+
+    last_frame = frame;
+    totals.frames++;
+    totals.areas_in += frame.areas_in;
+    totals.areas_out += frame.areas_out;
+    totals.bytes_in += frame.bytes_in;
+    totals.bytes_out += frame.bytes_out;
+    totals.cost_us_in += frame.cost_us_in;
+    totals.cost_us_out += frame.cost_us_out;
+}
+
+static void flush_opt_reset(void) {
+    memset(&totals, 0, sizeof(totals));
+    memset(&last_frame, 0, sizeof(last_frame));
+    totals.start_ms = k_uptime_get_32();
+}
+
+void flush_opt_start(void) {
+    if (opt_started) {
+        return;
+    }
+
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp) {
+        return;
+    }
+
+    lv_display_add_event_cb(disp, flush_opt_refr_start_cb, LV_EVENT_REFR_START, NULL);
+    flush_opt_reset();
+    opt_started = true;
+    LOG_INF("Flush optimizer: %u Hz SPI, %u ns/byte, %u us per area", FLUSH_OPT_SPI_HZ,
+            (uint32_t)FLUSH_OPT_BYTE_NS, opt_overhead_us);
+}
+
+void flush_opt_get_last(struct flush_opt_frame *frame) {
+    *frame = last_frame;
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+/* Shell runs outside the LVGL thread: counters are read without locking */
+static int cmd_flush(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0) {
+            opt_enabled = strcmp(argv[1], "on") == 0;
+        } else if (strcmp(argv[1], "overhead") == 0 && argc >= 3) {
+            opt_overhead_us = strtoul(argv[2], NULL, 10);
+        } else if (strcmp(argv[1], "reset") != 0) {
+            shell_error(sh, "Usage: prospector flush [on|off|reset|overhead <us>]");
+            return -EINVAL;
+        }
+        flush_opt_reset();
+        shell_print(sh, "Flush optimizer %s, %u us per area, counters reset",
+                    opt_enabled ? "on" : "off", opt_overhead_us);
+        return 0;
+    }
+
+    struct flush_opt_totals st = totals;
+    struct flush_opt_frame last = last_frame;
+
+    shell_print(sh, "Flush optimizer: %s, %u ns/byte, %u us per area, over %u ms",
+                opt_enabled ? "on" : "off", (uint32_t)FLUSH_OPT_BYTE_NS, opt_overhead_us,
+                k_uptime_get_32() - st.start_ms);
+    shell_print(sh, "Last frame: areas %u -> %u, bytes %u -> %u, cost %u -> %u us",
+                last.areas_in, last.areas_out, last.bytes_in, last.bytes_out, last.cost_us_in,
+                last.cost_us_out);
+    if (st.frames) {
+        shell_print(sh, "%u frames, %u merges, avg areas %u -> %u, avg bytes %u -> %u",
+                    st.frames, st.merges, (uint32_t)(st.areas_in / st.frames),
+                    (uint32_t)(st.areas_out / st.frames), (uint32_t)(st.bytes_in / st.frames),
+                    (uint32_t)(st.bytes_out / st.frames));
+        shell_print(sh, "Modelled cost: avg %u -> %u us per frame",
+                    (uint32_t)(st.cost_us_in / st.frames), (uint32_t)(st.cost_us_out / st.frames));
+    }
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), flush, NULL, "Flush area optimizer [on|off|reset|overhead <us>]",
+                 cmd_flush, 1, 2);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
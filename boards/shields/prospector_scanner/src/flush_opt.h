@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Dirty-rectangle merging before LVGL's refresh
+ *
+ * Small widget updates (modifier label, WPM, battery bars, RSSI, rate)
+ * each become one render pass and one CASET/RASET/RAMWR sequence. At the
+ * start of a refresh the invalidated areas are merged pairwise when the
+ * bounding box is cheaper to send than both areas, with a cost model of
+ * SPI bytes at the panel clock plus a fixed overhead per flush area.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+struct flush_opt_frame {
+    uint16_t areas_in;   /* Invalidated areas LVGL would flush */
+    uint16_t areas_out;  /* ...after merging */
+    uint32_t bytes_in;
+    uint32_t bytes_out;
+    uint32_t cost_us_in;   /* Modelled flush cost before merging */
+    uint32_t cost_us_out;  /* ...after merging */
+};
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_FLUSH_OPTIMIZER)
+
+/**
+ * @brief Attach the optimizer to the default display
+ *
+ * LVGL thread, once the display exists.
+ */
+void flush_opt_start(void);
+
+/** Statistics of the last refresh that had invalidated areas */
+void flush_opt_get_last(struct flush_opt_frame *frame);
+
+#else
+
+static inline void flush_opt_start(void) {}
+
+static inline void flush_opt_get_last(struct flush_opt_frame *frame) {
+    *frame = (struct flush_opt_frame){0};
+}
+
+#endif
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Frame rate and flush statistics (see frame_stats.h)
+ *
+ * A refresh is timed from LV_EVENT_REFR_START to LV_EVENT_REFR_READY and
+ * includes rendering and flushing. With a synchronous flush the refresh
+ * time grows with the SPI transfer time; with the asynchronous flush it
+ * only includes the wait for the previous transfer ("wait"), so render
+ * and SPI overlap. "prospector fps" prints the counters since the last
+ * reset.
+ *
+ * "prospector fps bench [frames]" measures raw flush throughput: full
+ * frames are written as FRAME_BENCH_LINES-line bands with display_write()
+ * from the display work queue, bypassing LVGL rendering, and the screen
+ * is invalidated afterwards to restore it. Frames alternate between two
+ * constant bands, so no buffer is rewritten while the asynchronous flush
+ * may still be reading it.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+#include <zephyr/logging/log.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#include "frame_stats.h"
+#include "display_sched.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_DRIVER)
+#include <display_st7789v.h>
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(frame_stats, LOG_LEVEL_INF);
+
+struct frame_stats {
+    uint32_t frames;   /* Refreshes that rendered something */
+    uint32_t flushes;  /* flush_cb calls (one per area and buffer) */
+    uint32_t refr_us_max;
+    uint64_t refr_us_total;
+    uint64_t render_us_total;
+    uint64_t flush_us_total;
+    uint64_t flush_px;
+    uint64_t handler_us_start;
+    uint32_t start_ms;
+};
+
+static struct frame_stats stats;
+static uint32_t refr_start_cyc;
+static uint32_t render_start_cyc;
+static uint32_t flush_start_cyc;
+static uint32_t render_flush_us;  /* Time in flush_cb during this render */
+static bool refr_rendered;
+static bool stats_started;
+
+static void frame_stats_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    stats.start_ms = k_uptime_get_32();
+    stats.handler_us_start = display_sched_handler_us();
+#if IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_DRIVER)
+    st7789v_reset_stats(DEVICE_DT_GET(DT_CHOSEN(zephyr_display)));
+#endif
+}
+
+static void frame_stats_event_cb(lv_event_t *e) {
+    switch (lv_event_get_code(e)) {
+    case LV_EVENT_REFR_START:
+        refr_start_cyc = k_cycle_get_32();
+        refr_rendered = false;
+        break;
+    case LV_EVENT_RENDER_START:
+        refr_rendered = true;
+        render_start_cyc = k_cycle_get_32();
+        render_flush_us = 0;
+        break;
+    case LV_EVENT_RENDER_READY: {
+        uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - render_start_cyc);
+        stats.render_us_total += us > render_flush_us ? us - render_flush_us : 0;
+        break;
+    }
+    case LV_EVENT_FLUSH_START: {
+        const lv_area_t *area = lv_event_get_param(e);
+        stats.flushes++;
+        if (area) {
+            stats.flush_px += lv_area_get_size(area);
+        }
+        flush_start_cyc = k_cycle_get_32();
+        break;
+    }
+    case LV_EVENT_FLUSH_FINISH: {
+        uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - flush_start_cyc);
+        stats.flush_us_total += us;
+        render_flush_us += us;
+        break;
+    }
+    case LV_EVENT_REFR_READY:
+        /* Refresh timer runs with nothing invalidated are not frames */
+        if (refr_rendered) {
+            uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - refr_start_cyc);
+            stats.frames++;
+            stats.refr_us_total += us;
+            stats.refr_us_max = MAX(stats.refr_us_max, us);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void frame_stats_start(void) {
+    if (stats_started) {
+        return;
+    }
+
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp) {
+        return;
+    }
+
+    lv_display_add_event_cb(disp, frame_stats_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, frame_stats_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, frame_stats_event_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_display_add_event_cb(disp, frame_stats_event_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(disp, frame_stats_event_cb, LV_EVENT_FLUSH_FINISH, NULL);
+    lv_display_add_event_cb(disp, frame_stats_event_cb, LV_EVENT_REFR_READY, NULL);
+    frame_stats_reset();
+    stats_started = true;
+}
+
+void frame_stats_get(struct frame_stats_snapshot *snap) {
+    struct frame_stats st = stats;
+
+    snap->start_ms = st.start_ms;
+    snap->frames = st.frames;
+    snap->flushes = st.flushes;
+    snap->flush_px = st.flush_px;
+    snap->refr_us = st.refr_us_total;
+    snap->render_us = st.render_us_total;
+    snap->flush_us = st.flush_us_total;
+    snap->handler_us = display_sched_handler_us() - st.handler_us_start;
+#if IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_DRIVER)
+    struct st7789v_stats drv;
+    st7789v_get_stats(DEVICE_DT_GET(DT_CHOSEN(zephyr_display)), &drv);
+    snap->spi_busy_us = drv.busy_us;
+#else
+    snap->spi_busy_us = st.flush_us_total;
+#endif
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+#define FRAME_BENCH_LINES 10
+#define FRAME_BENCH_WIDTH DT_PROP(DT_CHOSEN(zephyr_display), width)
+#define FRAME_BENCH_HEIGHT DT_PROP(DT_CHOSEN(zephyr_display), height)
+#define FRAME_BENCH_BPP (LV_COLOR_DEPTH / 8)
+
+/* Black and white band, filled once per bench run before any write */
+static uint8_t bench_buf[2][FRAME_BENCH_WIDTH * FRAME_BENCH_LINES * FRAME_BENCH_BPP];
+static uint32_t bench_frames;
+static uint32_t bench_us;
+static int bench_err;
+static K_SEM_DEFINE(bench_done, 0, 1);
+
+/* Display work queue: no LVGL flush can run in between */
+static void frame_bench_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    const struct device *display = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+    struct display_buffer_descriptor desc = {
+        .buf_size = sizeof(bench_buf[0]),
+        .width = FRAME_BENCH_WIDTH,
+        .height = FRAME_BENCH_LINES,
+        .pitch = FRAME_BENCH_WIDTH,
+    };
+
+    /* The previous run's last band is long done: the LVGL flush that
+     * restored the screen after it waited for the transfer */
+    memset(bench_buf[0], 0x00, sizeof(bench_buf[0]));
+    memset(bench_buf[1], 0xff, sizeof(bench_buf[1]));
+
+    bench_err = 0;
+    uint32_t start = k_cycle_get_32();
+    for (uint32_t frame = 0; frame < bench_frames && !bench_err; frame++) {
+        /* Change the pattern each frame so the panel visibly updates */
+        const uint8_t *band = bench_buf[frame & 1];
+        for (uint16_t y = 0; y + FRAME_BENCH_LINES <= FRAME_BENCH_HEIGHT;
+             y += FRAME_BENCH_LINES) {
+            bench_err = display_write(display, 0, y, &desc, band);
+            if (bench_err) {
+                break;
+            }
+        }
+    }
+    /* With the async flush the last band may still be in flight (< 1 band) */
+    bench_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+    lv_obj_invalidate(lv_screen_active());
+    k_sem_give(&bench_done);
+}
+
+static K_WORK_DEFINE(frame_bench_work, frame_bench_work_handler);
+
+static int cmd_fps_bench(const struct shell *sh, uint32_t frames) {
+    if (frames == 0 || frames > 1000) {
+        shell_error(sh, "Frames must be 1-1000");
+        return -EINVAL;
+    }
+
+    bench_frames = frames;
+    k_sem_reset(&bench_done);
+    k_work_submit_to_queue(zmk_display_work_q(), &frame_bench_work);
+    if (k_sem_take(&bench_done, K_SECONDS(60)) != 0) {
+        shell_error(sh, "Benchmark did not finish");
+        return -ETIMEDOUT;
+    }
+    if (bench_err) {
+        shell_error(sh, "display_write failed (%d)", bench_err);
+        return bench_err;
+    }
+
+    uint64_t bytes = (uint64_t)frames * FRAME_BENCH_WIDTH *
+                     (FRAME_BENCH_HEIGHT / FRAME_BENCH_LINES * FRAME_BENCH_LINES) *
+                     FRAME_BENCH_BPP;
+    uint32_t us = MAX(bench_us, 1);
+
+    shell_print(sh, "%u frames %ux%u in %u ms: %u us/frame, %u.%02u fps, %u KB/s", frames,
+                FRAME_BENCH_WIDTH, FRAME_BENCH_HEIGHT, us / 1000, us / frames,
+                (uint32_t)(frames * 1000000ULL / us), (uint32_t)(frames * 100000000ULL / us % 100),
+                (uint32_t)(bytes * 1000000U / 1024 / us));
+    return 0;
+}
+
+/* Shell runs outside the LVGL thread: counters are read without locking */
+static int cmd_fps(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        return cmd_fps_bench(sh, argc >= 3 ? strtoul(argv[2], NULL, 10) : 20);
+    }
+
+    if (argc >= 2) {
+        if (strcmp(argv[1], "reset") != 0) {
+            shell_error(sh, "Usage: prospector fps [reset|bench [frames]]");
+            return -EINVAL;
+        }
+        frame_stats_reset();
+        shell_print(sh, "Frame counters reset");
+        return 0;
+    }
+
+    struct frame_stats st = stats;
+    uint32_t window_ms = MAX(k_uptime_get_32() - st.start_ms, 1);
+
+    shell_print(sh, "Frames: %u over %u ms (%u.%02u fps), flushes %u", st.frames, window_ms,
+                st.frames * 1000U / window_ms, (st.frames * 100000U / window_ms) % 100,
+                st.flushes);
+    if (st.frames) {
+        shell_print(sh, "Refresh: avg %u us, max %u us (render %u us, flush %u us)",
+                    (uint32_t)(st.refr_us_total / st.frames), st.refr_us_max,
+                    (uint32_t)(st.render_us_total / st.frames),
+                    (uint32_t)(st.flush_us_total / st.frames));
+    }
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_DRIVER)
+    struct st7789v_stats drv;
+    st7789v_get_stats(DEVICE_DT_GET(DT_CHOSEN(zephyr_display)), &drv);
+    uint32_t busy_permille = (uint32_t)(drv.busy_us / window_ms);
+
+    shell_print(sh, "ST7789V (%s): %u writes, %u KB, SPI busy %u us (%u.%u%%), wait %u us",
+                IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_ASYNC) ? "async" : "sync", drv.writes,
+                (uint32_t)(drv.bytes / 1024), (uint32_t)drv.busy_us, busy_permille / 10,
+                busy_permille % 10, (uint32_t)drv.wait_us);
+#endif
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), fps, NULL,
+                 "Frame rate and flush statistics [reset|bench [frames]]", cmd_fps, 1, 2);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Frame rate and flush statistics
+ *
+ * Counts LVGL refreshes and flushes from display events. With the module's
+ * ST7789V driver (CONFIG_PROSPECTOR_ST7789V_DRIVER) the driver's pixel
+ * bytes, SPI busy time and time spent waiting for the previous transfer
+ * are reported as well, to compare synchronous and asynchronous flushing.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+/* Counters since the last reset (start_ms); totals, not rates */
+struct frame_stats_snapshot {
+    uint32_t start_ms;
+    uint32_t frames;
+    uint32_t flushes;
+    uint64_t flush_px;     /* Pixels passed to flush_cb */
+    uint64_t refr_us;      /* REFR_START..REFR_READY of rendered frames */
+    uint64_t render_us;    /* RENDER_START..RENDER_READY minus time in flush_cb */
+    uint64_t flush_us;     /* Time in flush_cb (display_write) */
+    uint64_t spi_busy_us;  /* ST7789V driver SPI busy time, else flush_us */
+    uint64_t handler_us;   /* lv_timer_handler() time (tickless scheduler only) */
+};
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_FRAME_STATS)
+
+/**
+ * @brief Attach the display event counters
+ *
+ * LVGL thread, once the display exists.
+ */
+void frame_stats_start(void);
+
+/** Any thread; counters are copied without locking */
+void frame_stats_get(struct frame_stats_snapshot *snap);
+
+#else
+
+static inline void frame_stats_start(void) {}
+
+static inline void frame_stats_get(struct frame_stats_snapshot *snap) {
+    *snap = (struct frame_stats_snapshot){0};
+}
+
+#endif
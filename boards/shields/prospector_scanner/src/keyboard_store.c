@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Known-keyboard table persistence (see keyboard_store.h)
+ *
+ * Boot: the table is loaded in SYS_INIT and handed to scanner_stub, so the
+ * main screen shows the last-known keyboard (marked stale) on its first
+ * update instead of "Scanning...".
+ * Runtime: saves run from the system work queue, never from the BLE or
+ * LVGL threads, and only slots whose content changed are written.
+ *
+ * Display preferences are not per keyboard: the Display Settings values
+ * apply to every keyboard and are persisted by display_settings_store.c
+ * (CONFIG_PROSPECTOR_SETTINGS_STORE).
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "keyboard_store.h"
+#include "scanner_stub.h"
+
+LOG_MODULE_REGISTER(keyboard_store, LOG_LEVEL_INF);
+
+#define STORE_SUBTREE  "prospector/kbd"
+#define STORE_VERSION  1
+
+/* Settings value: version byte + slot snapshot */
+struct keyboard_store_record {
+    uint8_t version;
+    struct scanner_saved_keyboard kb;
+} __packed;
+
+/* Last written content per slot - skip writes that change nothing */
+static struct keyboard_store_record saved[SCANNER_STUB_MAX_KEYBOARDS];
+static int8_t saved_selected = -1;
+
+/* Only the boot load restores into scanner_stub; ZMK's later
+ * settings_load() must not undo runtime changes */
+static bool store_boot_load;
+
+/*
+ * Keep only what is restored: identity and the last layer, batteries and
+ * profile. Live fields (WPM, modifiers, status flags...) would make
+ * nearly every save differ from the stored record.
+ */
+static void store_record_from_slot(struct keyboard_store_record *rec,
+                                   const struct scanner_saved_keyboard *kb) {
+    memset(rec, 0, sizeof(*rec));
+    rec->version = STORE_VERSION;
+    memcpy(rec->kb.ble_addr, kb->ble_addr, sizeof(rec->kb.ble_addr));
+    rec->kb.ble_addr_type = kb->ble_addr_type;
+    memcpy(rec->kb.name, kb->name, sizeof(rec->kb.name));
+
+    struct zmk_status_adv_data *d = &rec->kb.data;
+    memcpy(d->manufacturer_id, kb->data.manufacturer_id, sizeof(d->manufacturer_id));
+    memcpy(d->service_uuid, kb->data.service_uuid, sizeof(d->service_uuid));
+    d->version = kb->data.version;
+    d->battery_level = kb->data.battery_level;
+    d->active_layer = kb->data.active_layer;
+    d->profile_slot = kb->data.profile_slot;
+    d->device_role = kb->data.device_role;
+    d->device_index = kb->data.device_index;
+    memcpy(d->peripheral_battery, kb->data.peripheral_battery, sizeof(d->peripheral_battery));
+    memcpy(d->layer_name, kb->data.layer_name, sizeof(d->layer_name));
+    memcpy(d->keyboard_id, kb->data.keyboard_id, sizeof(d->keyboard_id));
+    d->channel = kb->data.channel;
+}
+
+static void store_save_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(store_save_work, store_save_work_handler);
+
+static void store_save_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    int written = 0;
+
+    for (int i = 0; i < SCANNER_STUB_MAX_KEYBOARDS; i++) {
+        struct scanner_saved_keyboard kb;
+        struct keyboard_store_record rec;
+
+        if (!scanner_get_saved_keyboard(i, &kb)) {
+            continue;
+        }
+        store_record_from_slot(&rec, &kb);
+        if (memcmp(&rec, &saved[i], sizeof(rec)) == 0) {
+            continue;
+        }
+
+        char key[24];
+        snprintf(key, sizeof(key), STORE_SUBTREE "/%d", i);
+        int err = settings_save_one(key, &rec, sizeof(rec));
+        if (err) {
+            LOG_WRN("Saving slot %d failed: %d", i, err);
+            continue;
+        }
+        saved[i] = rec;
+        written++;
+    }
+
+    int8_t selected = (int8_t)scanner_get_selected_keyboard();
+    if (selected != saved_selected &&
+        settings_save_one(STORE_SUBTREE "/sel", &selected, sizeof(selected)) == 0) {
+        saved_selected = selected;
+        written++;
+    }
+
+    if (written > 0) {
+        LOG_INF("Keyboard table saved (%d entries)", written);
+    }
+}
+
+void keyboard_store_mark_dirty(bool identity) {
+    k_timeout_t delay = identity ? K_SECONDS(CONFIG_PROSPECTOR_KEYBOARD_STORE_IDENTITY_DELAY_S)
+                                 : K_SECONDS(CONFIG_PROSPECTOR_KEYBOARD_STORE_STATE_DELAY_S);
+
+    /* Pull a pending long save forward for identity changes; otherwise a
+     * pending save absorbs this request */
+    if (identity && k_work_delayable_is_pending(&store_save_work) &&
+        k_work_delayable_remaining_get(&store_save_work) > delay.ticks) {
+        k_work_reschedule(&store_save_work, delay);
+    } else {
+        k_work_schedule(&store_save_work, delay);
+    }
+}
+
+static int store_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+                              void *cb_arg) {
+    const char *next;
+
+    if (settings_name_steq(name, "sel", &next) && !next) {
+        int8_t selected;
+        if (len != sizeof(selected) || read_cb(cb_arg, &selected, sizeof(selected)) < 0) {
+            return -EINVAL;
+        }
+        saved_selected = selected;
+        if (store_boot_load) {
+            scanner_restore_selected_keyboard(selected);
+        }
+        return 0;
+    }
+
+    int slot = atoi(name);
+    if (slot < 0 || slot >= SCANNER_STUB_MAX_KEYBOARDS) {
+        return -ENOENT;
+    }
+
+    struct keyboard_store_record rec;
+    if (len != sizeof(rec) || read_cb(cb_arg, &rec, sizeof(rec)) < 0 ||
+        rec.version != STORE_VERSION) {
+        /* Old layout - ignore, overwritten on next save */
+        return 0;
+    }
+
+    rec.kb.name[sizeof(rec.kb.name) - 1] = '\0';
+    saved[slot] = rec;
+    if (store_boot_load) {
+        scanner_restore_keyboard(slot, &rec.kb);
+    }
+    return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(prospector_kbd, STORE_SUBTREE, NULL, store_settings_set, NULL, NULL);
+
+static int keyboard_store_init(void) {
+    int err = settings_subsys_init();
+    if (err) {
+        LOG_ERR("Settings init failed: %d", err);
+        return 0;
+    }
+
+    /* Load only our subtree now - the full settings_load() runs later */
+    store_boot_load = true;
+    settings_load_subtree(STORE_SUBTREE);
+    store_boot_load = false;
+    return 0;
+}
+
+/* Before scanner start (98) so restored slots exist when packets arrive */
+SYS_INIT(keyboard_store_init, APPLICATION, 90);
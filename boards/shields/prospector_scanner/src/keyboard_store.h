@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Known-keyboard table persisted through Zephyr settings
+ * ("prospector/kbd/<slot>" and "prospector/kbd/sel").
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+/**
+ * @brief Request a write-behind save of the keyboard table
+ *
+ * Cheap, callable from the BLE receive path. Requests are coalesced:
+ * identity changes (new keyboard, name, selection) are saved after a
+ * short delay, status changes (layer, battery) after a long one.
+ *
+ * @param identity true for identity changes
+ */
+void keyboard_store_mark_dirty(bool identity);
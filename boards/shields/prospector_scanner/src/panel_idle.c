@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Dimmed dashboard (see panel_idle.h)
+ *
+ * Idle mode shows only the MSB of each color channel. To switch without a
+ * visible jump, the display's flush callback is wrapped and, while idle
+ * mode is wanted, every RGB565 pixel is reduced to exactly what the panel
+ * shows in idle mode (each channel all-on or all-off) before it is sent:
+ *
+ *   enter: quantize on -> redraw the whole screen -> after that frame is
+ *          flushed send IDMON (the frame looks the same in both modes)
+ *   leave: send IDMOFF (same frame, full-color mode) -> quantize off ->
+ *          redraw the whole screen
+ *
+ * The screens set explicit colors everywhere rather than through an LVGL
+ * theme, so the 8-color palette is applied at flush time instead of as a
+ * theme. Quantizing runs before Zephyr's flush callback, i.e. before any
+ * byte swap for the panel.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+#include <lvgl.h>
+#include <src/display/lv_display_private.h>  /* flush_cb */
+#include <zmk/display.h>
+
+#include "panel_idle.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_DRIVER)
+#include <display_st7789v.h>
+#elif IS_ENABLED(CONFIG_MIPI_DBI)
+#include <zephyr/drivers/mipi_dbi.h>
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(panel_idle, LOG_LEVEL_INF);
+
+#define PANEL_IDLE_DISPLAY DT_CHOSEN(zephyr_display)
+#define PANEL_IDLE_EVAL_MS 1000
+
+/* MIPI DCS idle mode commands, same on the ST7789V */
+#define PANEL_CMD_IDMOFF 0x38
+#define PANEL_CMD_IDMON 0x39
+
+enum panel_idle_state {
+    PANEL_FULL_COLOR,
+    PANEL_ENTERING,  /* Quantized redraw pending, IDMON after it */
+    PANEL_IDLE,
+};
+
+static panel_idle_dim_cb_t panel_dim_cb;
+static lv_display_flush_cb_t orig_flush_cb;
+static lv_timer_t *eval_timer;
+static bool kb_present;
+static bool suspended;  /* Dashboard not shown */
+static uint32_t last_active_ms;
+static bool dimmed;
+static uint8_t dim_level;
+static enum panel_idle_state panel_state = PANEL_FULL_COLOR;
+static bool quantize;
+static bool entering_rendered;
+static bool idle_mode_enabled = IS_ENABLED(CONFIG_PROSPECTOR_PANEL_IDLE_MODE);
+static uint32_t idle_entries;
+static uint64_t idle_ms_total;
+static uint32_t idle_since_ms;
+
+extern volatile int32_t scanner_signal_rate_x100;
+
+static int panel_idle_send(bool idle) {
+#if IS_ENABLED(CONFIG_PROSPECTOR_ST7789V_DRIVER)
+    return st7789v_set_idle_mode(DEVICE_DT_GET(PANEL_IDLE_DISPLAY), idle);
+#elif IS_ENABLED(CONFIG_MIPI_DBI) &&                                                               \
+    DT_NODE_HAS_COMPAT(DT_PARENT(PANEL_IDLE_DISPLAY), zephyr_mipi_dbi_spi)
+    static const struct mipi_dbi_config dbi_config = {
+        .mode = MIPI_DBI_MODE_SPI_4WIRE,
+        .config = MIPI_DBI_SPI_CONFIG_DT(PANEL_IDLE_DISPLAY,
+                                         SPI_OP_MODE_MASTER | SPI_WORD_SET(8), 0),
+    };
+    return mipi_dbi_command_write(DEVICE_DT_GET(DT_PARENT(PANEL_IDLE_DISPLAY)), &dbi_config,
+                                  idle ? PANEL_CMD_IDMON : PANEL_CMD_IDMOFF, NULL, 0);
+#else
+    ARG_UNUSED(idle);
+    return -ENOTSUP;
+#endif
+}
+
+/* Each RGB565 channel to all-on or all-off by its MSB, as idle mode shows it */
+static void panel_idle_quantize(uint16_t *px, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t p = px[i];
+        px[i] = ((p & 0x8000) ? 0xF800 : 0) | ((p & 0x0400) ? 0x07E0 : 0) |
+                ((p & 0x0010) ? 0x001F : 0);
+    }
+}
+
+static void panel_idle_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    if (quantize) {
+        panel_idle_quantize((uint16_t *)px_map, lv_area_get_size(area));
+    }
+    orig_flush_cb(disp, area, px_map);
+}
+
+static void panel_idle_redraw(void) {
+    lv_obj_invalidate(lv_screen_active());
+    lv_obj_invalidate(lv_layer_top());
+}
+
+/* The quantized full-screen frame is on the panel: switch modes under it */
+static void panel_idle_refr_cb(lv_event_t *e) {
+    if (panel_state != PANEL_ENTERING) {
+        return;
+    }
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        entering_rendered = true;
+        return;
+    }
+    if (!entering_rendered) {
+        return;
+    }
+
+    int ret = panel_idle_send(true);
+    if (ret < 0) {
+        LOG_WRN("Panel idle mode not available (%d)", ret);
+        quantize = false;
+        panel_state = PANEL_FULL_COLOR;
+        panel_idle_redraw();
+        return;
+    }
+    panel_state = PANEL_IDLE;
+    idle_entries++;
+    idle_since_ms = k_uptime_get_32();
+    LOG_INF("Panel idle mode (8 colors) on");
+}
+
+static void panel_idle_set(bool idle) {
+    if (idle && panel_state == PANEL_FULL_COLOR) {
+        quantize = true;
+        entering_rendered = false;
+        panel_state = PANEL_ENTERING;
+        panel_idle_redraw();
+    } else if (!idle && panel_state != PANEL_FULL_COLOR) {
+        if (panel_state == PANEL_IDLE) {
+            panel_idle_send(false);
+            idle_ms_total += k_uptime_get_32() - idle_since_ms;
+            LOG_INF("Panel idle mode off");
+        }
+        quantize = false;
+        panel_state = PANEL_FULL_COLOR;
+        panel_idle_redraw();
+    }
+}
+
+static void panel_idle_eval(lv_timer_t *timer) {
+    ARG_UNUSED(timer);
+
+    bool dim = false;
+    uint8_t level = 100;
+    uint32_t now = k_uptime_get_32();
+
+    if (kb_present && !suspended) {
+#ifdef CONFIG_PROSPECTOR_SCANNER_IDLE_BRIGHTNESS_MS
+        if (now - last_active_ms >= CONFIG_PROSPECTOR_SCANNER_IDLE_BRIGHTNESS_MS) {
+            dim = true;
+            level = CONFIG_PROSPECTOR_SCANNER_IDLE_BRIGHTNESS_PERCENT;
+        }
+#endif
+#if IS_ENABLED(CONFIG_PROSPECTOR_ADVERTISEMENT_FREQUENCY_DIM)
+        /* Interval above the threshold = rate below 1000 / threshold Hz */
+        int32_t rate_x100 = scanner_signal_rate_x100;
+        if (rate_x100 >= 0 &&
+            rate_x100 * CONFIG_PROSPECTOR_ADV_FREQUENCY_DIM_THRESHOLD_MS < 100000) {
+            dim = true;
+            level = MIN(level, CONFIG_PROSPECTOR_ADV_FREQUENCY_DIM_BRIGHTNESS);
+        }
+#endif
+    }
+
+    if (dim != dimmed || (dim && level != dim_level)) {
+        dimmed = dim;
+        dim_level = level;
+        LOG_INF("Dashboard %s", dim ? "dimmed" : "restored");
+        if (panel_dim_cb) {
+            panel_dim_cb(dim, level);
+        }
+    }
+    panel_idle_set(dimmed && idle_mode_enabled);
+}
+
+void panel_idle_note_keyboard(bool present, bool active) {
+    bool was_present = kb_present;
+
+    kb_present = present;
+    if (active || (present && !was_present)) {
+        last_active_ms = k_uptime_get_32();
+    }
+
+    /* Leave the dim state at once on typing or loss of all keyboards */
+    if (dimmed && (active || !present)) {
+        panel_idle_eval(NULL);
+    }
+}
+
+/* Touch reports arrive on the input thread; dim state lives in the LVGL thread */
+static void panel_idle_activity_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    last_active_ms = k_uptime_get_32();
+    if (dimmed) {
+        panel_idle_eval(NULL);
+    }
+}
+
+static K_WORK_DEFINE(panel_idle_activity_work, panel_idle_activity_work_handler);
+
+void panel_idle_note_activity(void) {
+    k_work_submit_to_queue(zmk_display_work_q(), &panel_idle_activity_work);
+}
+
+void panel_idle_set_suspended(bool suspend) {
+    if (suspend == suspended) {
+        return;
+    }
+    suspended = suspend;
+    last_active_ms = k_uptime_get_32();
+    if (eval_timer) {
+        panel_idle_eval(NULL);
+    }
+}
+
+void panel_idle_init(panel_idle_dim_cb_t dim_cb) {
+    if (eval_timer) {
+        return;
+    }
+
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp) {
+        return;
+    }
+
+    panel_dim_cb = dim_cb;
+    last_active_ms = k_uptime_get_32();
+
+    if (IS_ENABLED(CONFIG_PROSPECTOR_PANEL_IDLE_MODE)) {
+        orig_flush_cb = disp->flush_cb;
+        lv_display_set_flush_cb(disp, panel_idle_flush_cb);
+        lv_display_add_event_cb(disp, panel_idle_refr_cb, LV_EVENT_RENDER_START, NULL);
+        lv_display_add_event_cb(disp, panel_idle_refr_cb, LV_EVENT_REFR_READY, NULL);
+    }
+
+    eval_timer = lv_timer_create(panel_idle_eval, PANEL_IDLE_EVAL_MS, NULL);
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+/* Shell runs outside the LVGL thread: state is read without locking */
+static int cmd_idle(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2) {
+        if (!IS_ENABLED(CONFIG_PROSPECTOR_PANEL_IDLE_MODE)) {
+            shell_error(sh, "Built without CONFIG_PROSPECTOR_PANEL_IDLE_MODE");
+            return -ENOTSUP;
+        }
+        if (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0) {
+            shell_error(sh, "Usage: prospector idle [on|off]");
+            return -EINVAL;
+        }
+        /* Applied by the next evaluation in the LVGL thread */
+        idle_mode_enabled = strcmp(argv[1], "on") == 0;
+        shell_print(sh, "Panel idle mode while dimmed: %s", idle_mode_enabled ? "on" : "off");
+        return 0;
+    }
+
+    static const char *const state_names[] = {"full color", "entering", "idle (8 colors)"};
+    uint64_t idle_ms = idle_ms_total +
+                       (panel_state == PANEL_IDLE ? k_uptime_get_32() - idle_since_ms : 0);
+
+    const char *dash = suspended ? "not shown" : (dimmed ? "dimmed" : "normal");
+
+    shell_print(sh, "Dashboard: %s (level %u%%), keyboard %s, last activity %u s ago",
+                dash, dimmed ? dim_level : 100,
+                kb_present ? "present" : "absent", (k_uptime_get_32() - last_active_ms) / 1000);
+    shell_print(sh, "Panel: %s, idle mode %s, %u entries, %u s in idle mode",
+                state_names[panel_state], idle_mode_enabled ? "enabled" : "disabled",
+                idle_entries, (uint32_t)(idle_ms / 1000));
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), idle, NULL, "Dimmed dashboard / panel idle mode [on|off]",
+                 cmd_idle, 1, 1);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
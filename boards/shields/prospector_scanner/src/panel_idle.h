@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Dimmed dashboard: backlight dim levels and ST7789V 8-color idle mode
+ *
+ * Evaluates the keyboard idle (PROSPECTOR_SCANNER_IDLE_BRIGHTNESS_*) and
+ * advertisement-frequency (PROSPECTOR_ADV_FREQUENCY_DIM_*) dim conditions
+ * once per second. Touch counts as activity, and nothing dims while
+ * another screen is shown. While dimmed the backlight hook gets the dim
+ * level and, with CONFIG_PROSPECTOR_PANEL_IDLE_MODE, the panel runs in its
+ * 8-color idle mode with frames quantized to match.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+/**
+ * @brief Backlight hook, LVGL thread
+ *
+ * @param dimmed true when entering a dim state
+ * @param brightness Dim level in percent (ignored when leaving)
+ */
+typedef void (*panel_idle_dim_cb_t)(bool dimmed, uint8_t brightness);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_PANEL_DIM)
+
+/** LVGL thread, once the display and status screen exist */
+void panel_idle_init(panel_idle_dim_cb_t dim_cb);
+
+/**
+ * @brief Report a processed keyboard update
+ *
+ * LVGL thread.
+ *
+ * @param present false once all keyboards timed out (never dimmed then)
+ * @param active true if the update shows typing (WPM, modifiers, layer)
+ */
+void panel_idle_note_keyboard(bool present, bool active);
+
+/**
+ * @brief Report user activity on the scanner itself (touch)
+ *
+ * Any thread; handled on the display work queue. Leaves any dim state at
+ * once and restarts the idle time.
+ */
+void panel_idle_note_activity(void);
+
+/**
+ * @brief Suspend dimming, e.g. while a screen other than the dashboard is shown
+ *
+ * LVGL thread. Suspending leaves any dim state at once; resuming restarts
+ * the idle time.
+ */
+void panel_idle_set_suspended(bool suspended);
+
+#else
+
+static inline void panel_idle_init(panel_idle_dim_cb_t dim_cb) { ARG_UNUSED(dim_cb); }
+
+static inline void panel_idle_note_keyboard(bool present, bool active) {
+    ARG_UNUSED(present);
+    ARG_UNUSED(active);
+}
+
+static inline void panel_idle_note_activity(void) {}
+
+static inline void panel_idle_set_suspended(bool suspended) { ARG_UNUSED(suspended); }
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Display pipeline statistics overlay (see perf_overlay.h)
+ *
+ * Rates are deltas between two frame_stats snapshots one update period
+ * apart; a counter reset ("prospector fps reset") skips one update. The
+ * overlay's own label change costs one small frame per period, which is
+ * included in the figures it shows.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <string.h>
+#include <lvgl.h>
+#include <zmk/display.h>
+
+#include "perf_overlay.h"
+#include "frame_stats.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(perf_overlay, LOG_LEVEL_INF);
+
+#define PERF_OVERLAY_PERIOD_MS 1000
+#define PERF_OVERLAY_BPP (LV_COLOR_DEPTH / 8)
+
+LV_FONT_DECLARE(lv_font_montserrat_12);
+
+static lv_obj_t *overlay_label;
+static lv_timer_t *overlay_timer;
+static struct frame_stats_snapshot prev;
+static uint32_t prev_ms;
+
+static void perf_overlay_update(lv_timer_t *timer) {
+    ARG_UNUSED(timer);
+
+    struct frame_stats_snapshot now;
+    uint32_t now_ms = k_uptime_get_32();
+    frame_stats_get(&now);
+
+    if (now.start_ms != prev.start_ms || now.frames < prev.frames) {
+        /* Counters were reset in between */
+        prev = now;
+        prev_ms = now_ms;
+        return;
+    }
+
+    uint32_t dt_ms = MAX(now_ms - prev_ms, 1);
+    uint32_t frames = now.frames - prev.frames;
+    uint32_t flushes = now.flushes - prev.flushes;
+    uint32_t kb_s = (uint32_t)((now.flush_px - prev.flush_px) * PERF_OVERLAY_BPP * 1000U / 1024U /
+                               dt_ms);
+    uint32_t render_us = frames ? (uint32_t)((now.render_us - prev.render_us) / frames) : 0;
+    uint32_t spi_pm = (uint32_t)((now.spi_busy_us - prev.spi_busy_us) / dt_ms);
+    uint32_t tmr_pm = (uint32_t)((now.handler_us - prev.handler_us) / dt_ms);
+    uint32_t fps_x10 = frames * 10000U / dt_ms;
+
+    char buf[96];
+    snprintf(buf, sizeof(buf),
+             "%u.%u fps  render %u.%u ms\n"
+             "flush %u KB/s  %u.%u areas\n"
+             "SPI %u.%u%%  timers %u.%u%%",
+             fps_x10 / 10, fps_x10 % 10, render_us / 1000, (render_us / 100) % 10, kb_s,
+             frames ? flushes / frames : 0, frames ? (flushes * 10 / frames) % 10 : 0,
+             spi_pm / 10, spi_pm % 10, tmr_pm / 10, tmr_pm % 10);
+    lv_label_set_text(overlay_label, buf);
+
+    prev = now;
+    prev_ms = now_ms;
+}
+
+static void perf_overlay_create(void) {
+    overlay_label = lv_label_create(lv_layer_top());
+    lv_obj_set_style_text_font(overlay_label, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_color(overlay_label, lv_color_hex(0x00FF80), 0);
+    lv_obj_set_style_bg_color(overlay_label, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(overlay_label, LV_OPA_70, 0);
+    lv_obj_set_style_pad_all(overlay_label, 3, 0);
+    lv_obj_align(overlay_label, LV_ALIGN_BOTTOM_LEFT, 0, 0);
+    lv_obj_remove_flag(overlay_label, LV_OBJ_FLAG_CLICKABLE);
+    lv_label_set_text(overlay_label, "measuring...");
+}
+
+void perf_overlay_set_visible(bool visible) {
+    if (visible == perf_overlay_is_visible()) {
+        return;
+    }
+
+    if (visible) {
+        if (!overlay_label) {
+            perf_overlay_create();
+        }
+        frame_stats_get(&prev);
+        prev_ms = k_uptime_get_32();
+        lv_obj_remove_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_move_foreground(overlay_label);
+        overlay_timer = lv_timer_create(perf_overlay_update, PERF_OVERLAY_PERIOD_MS, NULL);
+    } else {
+        lv_timer_delete(overlay_timer);
+        overlay_timer = NULL;
+        lv_obj_add_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+    }
+    LOG_INF("Pipeline stats overlay %s", visible ? "shown" : "hidden");
+}
+
+bool perf_overlay_is_visible(void) {
+    return overlay_timer != NULL;
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static volatile bool overlay_requested;
+
+/* The overlay is LVGL state - toggled on the display work queue */
+static void perf_overlay_shell_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+    perf_overlay_set_visible(overlay_requested);
+}
+
+static K_WORK_DEFINE(perf_overlay_shell_work, perf_overlay_shell_work_handler);
+
+static int cmd_overlay(const struct shell *sh, size_t argc, char **argv) {
+    if (argc < 2) {
+        shell_print(sh, "Stats overlay: %s", perf_overlay_is_visible() ? "on" : "off");
+        return 0;
+    }
+    if (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0) {
+        shell_error(sh, "Usage: prospector overlay [on|off]");
+        return -EINVAL;
+    }
+
+    overlay_requested = strcmp(argv[1], "on") == 0;
+    k_work_submit_to_queue(zmk_display_work_q(), &perf_overlay_shell_work);
+    shell_print(sh, "Stats overlay %s", overlay_requested ? "on" : "off");
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), overlay, NULL, "Pipeline statistics overlay [on|off]",
+                 cmd_overlay, 1, 1);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
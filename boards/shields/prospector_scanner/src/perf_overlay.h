@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Display pipeline statistics overlay
+ *
+ * A small label on LVGL's top layer, above every screen, showing once per
+ * second: frames per second, render time per frame, flushed bytes per
+ * second, flush areas per frame, SPI busy and lv_timer_handler() share of
+ * the second. Figures come from frame_stats (flush callback events and
+ * the ST7789V driver counters). Toggled from the Quick Actions screen or
+ * "prospector overlay on|off"; PROSPECTOR_PERF_OVERLAY_DEFAULT_ON shows
+ * it from boot.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <zephyr/sys/util.h>
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_PERF_OVERLAY)
+
+/** LVGL thread. Creates the overlay on first use. */
+void perf_overlay_set_visible(bool visible);
+
+bool perf_overlay_is_visible(void);
+
+#else
+
+static inline void perf_overlay_set_visible(bool visible) { ARG_UNUSED(visible); }
+
+static inline bool perf_overlay_is_visible(void) { return false; }
+
+#endif
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Render buffer benchmark matrix (see render_bench.h)
+ *
+ * Runs as one work item on the display work queue, so nothing else
+ * renders meanwhile. For each combination the display's buffers are
+ * replaced with lv_display_set_buffers() on slices of the original
+ * buffer memory; the original buffers and render mode are restored
+ * afterwards. Per scene the screen is entered once, then the whole
+ * screen is invalidated and rendered with lv_refr_now() RENDER_BENCH_FRAMES
+ * times; that is the worst case for every strategy (a full redraw).
+ *
+ * RAM is the render buffer bytes of the combination plus the LVGL heap in
+ * use with the scene shown (needs LV_Z_MEM_POOL_SYS_HEAP and
+ * SYS_HEAP_RUNTIME_STATS, else 0). The registering screen empties its
+ * screen cache for the run, so only the shown scene is held. The recommendation is the combination
+ * with the least buffer RAM whose mean frame time is within
+ * RENDER_BENCH_TOLERANCE_PCT of the fastest.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <string.h>
+#include <lvgl.h>
+#include <src/display/lv_display_private.h>  /* buf_1 / buf_2 / render_mode */
+#include <zmk/display.h>
+
+#include "render_bench.h"
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+#include <lvgl_mem.h>
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(render_bench, LOG_LEVEL_INF);
+
+#define RENDER_BENCH_FRAMES 8
+#define RENDER_BENCH_MAX_SCENES 6
+#define RENDER_BENCH_TOLERANCE_PCT 10
+#define RENDER_BENCH_ALIGN 64
+
+struct render_bench_combo {
+    uint8_t size_pct;  /* Buffer size, percent of one frame */
+    bool dbl;
+    bool full;
+};
+
+static const struct render_bench_combo bench_combos[] = {
+    {10, false, false}, {10, true, false},  {25, false, false}, {25, true, false},
+    {50, false, false}, {50, true, false},  {100, false, false}, {100, false, true},
+    {100, true, true},
+};
+
+struct render_bench_result {
+    bool run;
+    uint32_t buf_bytes;
+    uint32_t frame_us[RENDER_BENCH_MAX_SCENES];
+    uint32_t frame_us_max[RENDER_BENCH_MAX_SCENES];
+    uint32_t heap_bytes[RENDER_BENCH_MAX_SCENES];
+};
+
+static const struct render_bench_scene *bench_scenes;
+static size_t bench_scene_count;
+static void (*bench_begin_end)(bool begin);
+static struct render_bench_result bench_results[ARRAY_SIZE(bench_combos)];
+static int bench_err;
+static K_SEM_DEFINE(bench_done, 0, 1);
+
+void render_bench_register(const struct render_bench_scene *scenes, size_t count,
+                           void (*begin_end)(bool begin)) {
+    bench_scenes = scenes;
+    bench_scene_count = MIN(count, RENDER_BENCH_MAX_SCENES);
+    bench_begin_end = begin_end;
+}
+
+static uint32_t render_bench_heap_used(void) {
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+    return stats.allocated_bytes;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Place the combination's buffers in the original buffer memory: both
+ * halves of a double buffer in one region, or one per original buffer.
+ */
+static bool render_bench_place(const struct render_bench_combo *c, uint8_t *r1, uint32_t r1_size,
+                               uint8_t *r2, uint32_t r2_size, uint32_t size, uint8_t **b1,
+                               uint8_t **b2) {
+    uint32_t slot = ROUND_UP(size, RENDER_BENCH_ALIGN);
+
+    *b1 = r1;
+    *b2 = NULL;
+    if (size > r1_size) {
+        return false;
+    }
+    if (!c->dbl) {
+        return true;
+    }
+    if (r2 && size <= r2_size) {
+        *b2 = r2;
+        return true;
+    }
+    if (slot + size <= r1_size) {
+        *b2 = r1 + slot;
+        return true;
+    }
+    return false;
+}
+
+static void render_bench_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    lv_display_t *disp = lv_display_get_default();
+    bench_err = 0;
+    memset(bench_results, 0, sizeof(bench_results));
+
+    if (!disp || !disp->buf_1 || !bench_scene_count) {
+        bench_err = -ENODEV;
+        k_sem_give(&bench_done);
+        return;
+    }
+    /* Deep screen-off: nothing would be invalidated or rendered */
+    if (!lv_display_is_invalidation_enabled(disp)) {
+        bench_err = -EAGAIN;
+        k_sem_give(&bench_done);
+        return;
+    }
+
+    lv_draw_buf_t *orig_1 = disp->buf_1;
+    lv_draw_buf_t *orig_2 = disp->buf_2;
+    lv_display_render_mode_t orig_mode = disp->render_mode;
+    uint8_t *r1 = orig_1->data;
+    uint32_t r1_size = orig_1->data_size;
+    uint8_t *r2 = orig_2 ? orig_2->data : NULL;
+    uint32_t r2_size = orig_2 ? orig_2->data_size : 0;
+    uint32_t hor = lv_display_get_horizontal_resolution(disp);
+    uint32_t ver = lv_display_get_vertical_resolution(disp);
+    uint32_t line_bytes = lv_draw_buf_width_to_stride(hor, lv_display_get_color_format(disp));
+    uint32_t frame_bytes = line_bytes * ver;
+
+    if (bench_begin_end) {
+        bench_begin_end(true);
+    }
+
+    for (size_t ci = 0; ci < ARRAY_SIZE(bench_combos); ci++) {
+        const struct render_bench_combo *c = &bench_combos[ci];
+        struct render_bench_result *res = &bench_results[ci];
+        uint32_t lines = MAX(ver * c->size_pct / 100, 1);
+        uint32_t size = lines * line_bytes;
+        uint8_t *b1, *b2;
+
+        if (c->full && size < frame_bytes) {
+            continue;
+        }
+        if (!render_bench_place(c, r1, r1_size, r2, r2_size, size, &b1, &b2)) {
+            continue;
+        }
+
+        lv_display_set_buffers(disp, b1, b2, size,
+                               c->full ? LV_DISPLAY_RENDER_MODE_FULL
+                                       : LV_DISPLAY_RENDER_MODE_PARTIAL);
+        res->run = true;
+        res->buf_bytes = size * (b2 ? 2 : 1);
+
+        for (size_t si = 0; si < bench_scene_count; si++) {
+            bench_scenes[si].enter();
+            lv_refr_now(disp);
+            res->heap_bytes[si] = render_bench_heap_used();
+
+            uint64_t total_us = 0;
+            for (int f = 0; f < RENDER_BENCH_FRAMES; f++) {
+                uint32_t start = k_cycle_get_32();
+                lv_obj_invalidate(lv_screen_active());
+                lv_refr_now(disp);
+                uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+                total_us += us;
+                res->frame_us_max[si] = MAX(res->frame_us_max[si], us);
+            }
+            res->frame_us[si] = (uint32_t)(total_us / RENDER_BENCH_FRAMES);
+        }
+        LOG_INF("Combo %u%% %s %s done", c->size_pct, c->dbl ? "double" : "single",
+                c->full ? "full" : "partial");
+    }
+
+    lv_display_set_buffers(disp, r1, r2, r1_size, orig_mode);
+    if (bench_begin_end) {
+        bench_begin_end(false);
+    }
+    lv_obj_invalidate(lv_screen_active());
+    k_sem_give(&bench_done);
+}
+
+static K_WORK_DEFINE(render_bench_work, render_bench_work_handler);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static uint32_t render_bench_mean_us(const struct render_bench_result *res) {
+    uint64_t sum = 0;
+    for (size_t si = 0; si < bench_scene_count; si++) {
+        sum += res->frame_us[si];
+    }
+    return (uint32_t)(sum / bench_scene_count);
+}
+
+static int cmd_rbench(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    if (!bench_scene_count) {
+        shell_error(sh, "No screens registered (status screen not created yet)");
+        return -ENODEV;
+    }
+
+    shell_print(sh, "Rendering %zu screens x %zu combinations, %d full redraws each...",
+                bench_scene_count, ARRAY_SIZE(bench_combos), RENDER_BENCH_FRAMES);
+    k_sem_reset(&bench_done);
+    k_work_submit_to_queue(zmk_display_work_q(), &render_bench_work);
+    if (k_sem_take(&bench_done, K_SECONDS(180)) != 0) {
+        shell_error(sh, "Benchmark did not finish");
+        return -ETIMEDOUT;
+    }
+    if (bench_err == -EAGAIN) {
+        shell_error(sh, "Display is asleep, wake it first");
+        return bench_err;
+    }
+    if (bench_err) {
+        shell_error(sh, "Benchmark failed (%d)", bench_err);
+        return bench_err;
+    }
+
+    /* One column per scene: frame avg/max (ms) and RAM (render buffers + LVGL heap) */
+    char head[160];
+    int head_len = snprintf(head, sizeof(head), "%-19s %6s", "combination", "buf(K)");
+    for (size_t si = 0; si < bench_scene_count && (size_t)head_len < sizeof(head); si++) {
+        head_len += snprintf(head + head_len, sizeof(head) - head_len, "  %-16s",
+                             bench_scenes[si].name);
+    }
+    shell_print(sh, "%s", head);
+
+    int best = -1;
+    uint32_t best_us = UINT32_MAX;
+    for (size_t ci = 0; ci < ARRAY_SIZE(bench_combos); ci++) {
+        const struct render_bench_combo *c = &bench_combos[ci];
+        const struct render_bench_result *res = &bench_results[ci];
+        char line[160];
+        int len;
+
+        if (!res->run) {
+            shell_print(sh, "%3u%% %-6s %-7s  does not fit in the configured buffers",
+                        c->size_pct, c->dbl ? "double" : "single", c->full ? "full" : "partial");
+            continue;
+        }
+        len = snprintf(line, sizeof(line), "%3u%% %-6s %-7s %6u", c->size_pct,
+                       c->dbl ? "double" : "single", c->full ? "full" : "partial",
+                       res->buf_bytes / 1024);
+        for (size_t si = 0; si < bench_scene_count && (size_t)len < sizeof(line); si++) {
+            len += snprintf(line + len, sizeof(line) - len, "  %3u.%u/%3u.%u %3uK",
+                            res->frame_us[si] / 1000, (res->frame_us[si] / 100) % 10,
+                            res->frame_us_max[si] / 1000, (res->frame_us_max[si] / 100) % 10,
+                            (res->buf_bytes + res->heap_bytes[si]) / 1024);
+        }
+        shell_print(sh, "%s", line);
+
+        uint32_t mean = render_bench_mean_us(res);
+        if (mean < best_us) {
+            best_us = mean;
+        }
+    }
+
+    /* Least buffer RAM within tolerance of the fastest */
+    for (size_t ci = 0; ci < ARRAY_SIZE(bench_combos); ci++) {
+        const struct render_bench_result *res = &bench_results[ci];
+        if (!res->run ||
+            render_bench_mean_us(res) * 100 > best_us * (100 + RENDER_BENCH_TOLERANCE_PCT)) {
+            continue;
+        }
+        if (best < 0 || res->buf_bytes < bench_results[best].buf_bytes) {
+            best = ci;
+        }
+    }
+
+    if (best >= 0) {
+        const struct render_bench_combo *c = &bench_combos[best];
+        shell_print(sh, "Recommended (within %d%% of fastest, least RAM):",
+                    RENDER_BENCH_TOLERANCE_PCT);
+        shell_print(sh, "  CONFIG_LV_Z_VDB_SIZE=%u", c->size_pct);
+        shell_print(sh, "  CONFIG_LV_Z_DOUBLE_VDB=%s", c->dbl ? "y" : "n");
+        shell_print(sh, "  CONFIG_LV_Z_FULL_REFRESH=%s", c->full ? "y" : "n");
+    }
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), rbench, NULL, "Render buffer strategy benchmark matrix",
+                 cmd_rbench, 1, 0);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Render buffer benchmark matrix ("prospector rbench")
+ *
+ * Renders the real screens under each render buffer strategy that fits in
+ * the memory of the buffers Zephyr's LVGL glue allocated (LV_Z_VDB_SIZE,
+ * LV_Z_DOUBLE_VDB): buffer size as percent of a frame, single or double
+ * buffering, partial or full refresh. Reports frame time and RAM per
+ * combination and recommends a configuration.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <zephyr/sys/util.h>
+
+struct render_bench_scene {
+    const char *name;
+    void (*enter)(void);  /* LVGL thread: show the screen, built and settled */
+};
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_RENDER_BENCH)
+
+/**
+ * @brief Screens to benchmark
+ *
+ * LVGL thread. The table must stay valid.
+ *
+ * @param begin_end Called with true before the first scene (save the UI
+ *                  state) and with false after the last one (restore it)
+ */
+void render_bench_register(const struct render_bench_scene *scenes, size_t count,
+                           void (*begin_end)(bool begin));
+
+#else
+
+static inline void render_bench_register(const struct render_bench_scene *scenes, size_t count,
+                                         void (*begin_end)(bool begin)) {
+    ARG_UNUSED(scenes);
+    ARG_UNUSED(count);
+    ARG_UNUSED(begin_end);
+}
+
+#endif
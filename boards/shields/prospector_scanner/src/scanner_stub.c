@@ -9,9 +9,16 @@
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/bluetooth/bluetooth.h>
 #include <zmk/status_advertisement.h>
 #include <lvgl.h>
 
+#include "scanner_stub.h"
+#include "boot_timing.h"
+#include "ui_wake.h"
+#include "display_sleep.h"
+
 #if IS_ENABLED(CONFIG_ZMK_BATTERY_REPORTING)
 #include <zmk/battery.h>
 #endif
@@ -20,6 +27,22 @@
 #include <zmk/usb.h>
 #endif
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_USB_STREAM)
+#include "usb_stream.h"
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_TELEMETRY)
+#include "telemetry_log.h"
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_BATTERY_ESTIMATOR)
+#include "battery_estimator.h"
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_KEYBOARD_STORE)
+#include "keyboard_store.h"
+#endif
+
 LOG_MODULE_REGISTER(scanner_handler, LOG_LEVEL_INF);
 
 /* External scanner start function (from status_scanner.c) */
@@ -40,7 +63,7 @@ static volatile bool display_update_pending = false;
 
 /* ========== Keyboard Data Storage ========== */
 
-#define MAX_KEYBOARDS 3
+#define MAX_KEYBOARDS SCANNER_STUB_MAX_KEYBOARDS
 #define MAX_NAME_LEN 32
 
 struct keyboard_state {
@@ -51,9 +74,15 @@ struct keyboard_state {
     uint32_t last_seen;  // k_uptime_get_32()
     uint8_t ble_addr[6];     // BLE MAC address for unique identification
     uint8_t ble_addr_type;   // BLE address type
+    uint8_t hops;            // 0 = heard directly, N = via N relays
+    bool stale;              // Restored from flash, not heard since boot
+    uint32_t last_direct;    // k_uptime_get_32() of last direct reception
 };
 
 static struct keyboard_state keyboards[MAX_KEYBOARDS];
+static struct scanner_keyboard_stats keyboard_stats[MAX_KEYBOARDS];
+static struct scanner_display_stats display_stats;
+static uint32_t display_update_requested_at = 0;  /* First RX since last work run */
 static int selected_keyboard = 0;
 static struct k_mutex data_mutex;
 static bool mutex_initialized = false;
@@ -77,6 +106,8 @@ struct pending_display_data {
     int profile;
     uint8_t modifiers;
     int bat[4];
+    uint16_t bat_hours[4];                /* Estimated runtime, 0 = unknown */
+    bool stale;                           /* Last-known state restored at boot */
     int8_t rssi;
     float rate_hz;
     int scanner_battery;
@@ -127,6 +158,27 @@ bool scanner_get_pending_battery(int *level) {
     return true;
 }
 
+/* ========== Diagnostics ========== */
+
+static const uint32_t hist_bounds_ms[] = SCANNER_HIST_BOUNDS_MS;
+BUILD_ASSERT(ARRAY_SIZE(hist_bounds_ms) == SCANNER_HIST_BUCKETS - 1);
+
+int scanner_hist_bucket(uint32_t ms) {
+    return zmk_status_hist_bucket(hist_bounds_ms, ARRAY_SIZE(hist_bounds_ms), ms);
+}
+
+bool scanner_get_keyboard_stats(int index, struct scanner_keyboard_stats *stats) {
+    if (index < 0 || index >= MAX_KEYBOARDS) {
+        return false;
+    }
+    *stats = keyboard_stats[index];
+    return keyboards[index].active;
+}
+
+void scanner_get_display_stats(struct scanner_display_stats *stats) {
+    *stats = display_stats;
+}
+
 /* ========== Public API for Display ========== */
 
 bool scanner_get_keyboard_data(int index, struct zmk_status_adv_data *data,
@@ -177,9 +229,19 @@ int scanner_get_selected_keyboard(void) {
 /* Forward declaration */
 static void schedule_display_update(void);
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+static void follow_note_manual_selection(int index);
+#endif
+
 void scanner_set_selected_keyboard(int index) {
     if (index >= 0 && index < MAX_KEYBOARDS) {
         selected_keyboard = index;
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+        follow_note_manual_selection(index);
+#endif
+#if IS_ENABLED(CONFIG_PROSPECTOR_KEYBOARD_STORE)
+        keyboard_store_mark_dirty(true);
+#endif
         LOG_INF("Selected keyboard changed to slot %d", index);
         /* Immediately update display with new keyboard data */
         schedule_display_update();
@@ -211,15 +273,24 @@ static void display_update_work_handler(struct k_work *work) {
     ARG_UNUSED(work);
 
     display_update_pending = false;
+    display_stats.runs++;
+
+    if (display_update_requested_at != 0) {
+        uint32_t latency = k_uptime_get_32() - display_update_requested_at;
+        display_stats.latency_hist[scanner_hist_bucket(latency)]++;
+        display_update_requested_at = 0;
+    }
 
     /* Skip ALL updates when Pong Wars is active (different LVGL screen) */
     if (pong_wars_active) {
+        display_stats.skipped++;
         return;
     }
 
     /* Skip update if screen transition in progress */
     if (transition_in_progress) {
         LOG_DBG("Skipping update - transition in progress");
+        display_stats.skipped++;
         return;
     }
 
@@ -247,6 +318,7 @@ static void display_update_work_handler(struct k_work *work) {
             /* Reset signal data */
             set_signal_data(-100, -1.0f);
             pending_data.signal_update_pending = true;
+            ui_wake(UI_WAKE_DISPLAY);
 
             /* Reset rate calculation state */
             rate_last_calc_time = 0;
@@ -291,6 +363,12 @@ static void display_update_work_handler(struct k_work *work) {
     pending_data.bat[1] = data.peripheral_battery[0];
     pending_data.bat[2] = data.peripheral_battery[1];
     pending_data.bat[3] = data.peripheral_battery[2];
+    pending_data.stale = keyboards[selected_keyboard].stale;
+#if IS_ENABLED(CONFIG_PROSPECTOR_BATTERY_ESTIMATOR)
+    for (int i = 0; i < 4; i++) {
+        pending_data.bat_hours[i] = battery_estimator_get_hours(selected_keyboard, i);
+    }
+#endif
 
     /* Calculate reception rate from actual advertisement count (1Hz update with moving average) */
     last_rssi = rssi;
@@ -333,10 +411,13 @@ static void display_update_work_handler(struct k_work *work) {
         set_signal_data(rssi, avg_rate);
         pending_data.signal_update_pending = true;  /* Signal widget updates at 1Hz */
         rate_last_calc_time = now;
+        /* Keyboard select list refreshes its RSSI bars at the same rate */
+        ui_wake(UI_WAKE_KEYBOARDS);
     }
 
-    /* Set flag - LVGL timer in main thread will pick this up */
+    /* Set flag and wake the LVGL timer in main thread to pick this up */
     pending_data.update_pending = true;
+    ui_wake(UI_WAKE_DISPLAY);
 }
 
 static void schedule_display_update(void) {
@@ -347,13 +428,156 @@ static void schedule_display_update(void) {
 
     if (!display_update_pending) {
         display_update_pending = true;
+        display_update_requested_at = k_uptime_get_32();
+        display_stats.scheduled++;
         /* Schedule with small delay to batch rapid updates */
         k_work_schedule(&display_update_work, K_MSEC(50));
+    } else {
+        display_stats.coalesced++;
+    }
+}
+
+/* ========== Auto-follow (switch to the keyboard being typed on) ========== */
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+
+/* Activity is a change of WPM, modifiers or layer, not reception: keyboards
+ * advertise every 100-150 ms whether typed on or not, and battery levels
+ * also change on an idle keyboard. Changes closer together than
+ * FOLLOW_STREAK_GAP_MS form one streak; FOLLOW_MIN_STREAK of them are
+ * needed before a keyboard may take focus. */
+#define FOLLOW_STREAK_GAP_MS   2000
+#define FOLLOW_MIN_STREAK      2
+
+struct follow_state {
+    uint8_t streak;
+    uint32_t last_activity;                    /* 0 = never active */
+};
+
+static struct follow_state follow[MAX_KEYBOARDS];
+static bool follow_enabled = true;
+static uint32_t follow_last_switch = 0;
+static uint32_t follow_switch_count = 0;
+
+/* Called with data_mutex held, before keyboards[index] is overwritten */
+static void follow_detect_activity(int index, const struct zmk_status_adv_data *adv, uint32_t now) {
+    struct follow_state *fs = &follow[index];
+    const struct zmk_status_adv_data *prev = &keyboards[index].data;
+
+    if (!keyboards[index].active) {
+        memset(fs, 0, sizeof(*fs));
+        return;
+    }
+
+    bool active = adv->wpm_value != prev->wpm_value ||
+                  adv->modifier_flags != prev->modifier_flags ||
+                  adv->active_layer != prev->active_layer;
+    if (!active) {
+        return;
+    }
+
+    if (fs->last_activity != 0 && now - fs->last_activity < FOLLOW_STREAK_GAP_MS) {
+        if (fs->streak < UINT8_MAX) {
+            fs->streak++;
+        }
+    } else {
+        fs->streak = 1;
+    }
+    fs->last_activity = now;
+}
+
+/*
+ * Hysteresis: the shown keyboard keeps focus while it was active within the
+ * hold time, and after any switch no other switch happens for the hold time.
+ * Only selected_keyboard changes - the main screen widgets stay as they are
+ * and the next display update simply carries the other keyboard's data.
+ */
+static bool follow_consider_switch(int index, uint32_t now) {
+    const uint32_t hold_ms = CONFIG_PROSPECTOR_AUTO_FOLLOW_HOLD_MS;
+    const struct follow_state *cand = &follow[index];
+
+    if (!follow_enabled || index == selected_keyboard ||
+        cand->streak < FOLLOW_MIN_STREAK || now - cand->last_activity >= FOLLOW_STREAK_GAP_MS ||
+        (follow_last_switch != 0 && now - follow_last_switch < hold_ms)) {
+        return false;
     }
+
+    const struct follow_state *cur = &follow[selected_keyboard];
+    if (keyboards[selected_keyboard].active && cur->last_activity != 0 &&
+        now - cur->last_activity < hold_ms) {
+        return false;  /* Shown keyboard is still in use */
+    }
+
+    LOG_INF("Auto-follow: slot %d -> %d", selected_keyboard, index);
+    selected_keyboard = index;
+    follow_last_switch = now;
+    follow_switch_count++;
+
+    /* Rate display restarts for the new keyboard */
+    rate_last_calc_time = 0;
+    atomic_set(&adv_receive_count, 0);
+    rate_history_filled = false;
+    rate_history_idx = 0;
+    return true;
+}
+
+static void follow_note_manual_selection(int index) {
+    /* A manual choice holds like an automatic switch */
+    follow_last_switch = k_uptime_get_32();
+    follow[index].last_activity = follow_last_switch;
+}
+
+void scanner_set_auto_follow(bool enabled) {
+    follow_enabled = enabled;
+    LOG_INF("Auto-follow %s", enabled ? "enabled" : "disabled");
+}
+
+bool scanner_get_auto_follow(void) {
+    return follow_enabled;
+}
+
+uint32_t scanner_get_auto_follow_switches(void) {
+    return follow_switch_count;
 }
 
+#endif /* CONFIG_PROSPECTOR_AUTO_FOLLOW */
+
 /* ========== Scanner Message Functions ========== */
 
+/*
+ * Everything that follows a slot update, shared by direct and relayed
+ * receptions. Called after data_mutex is released.
+ */
+static void scanner_notify_stored(int index, const struct zmk_status_adv_data *adv_data,
+                                  int8_t rssi, const uint8_t *ble_addr, uint8_t ble_addr_type,
+                                  bool new_slot, bool followed) {
+#if IS_ENABLED(CONFIG_PROSPECTOR_USB_STREAM)
+    /* Forward every reception to the host at full advertisement rate */
+    usb_stream_send_keyboard(index, rssi, ble_addr, ble_addr_type, adv_data);
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_TELEMETRY)
+    telemetry_log_record_rx(index, adv_data, rssi);
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_BATTERY_ESTIMATOR)
+    battery_estimator_update(index, adv_data);
+#endif
+
+    /* First packet after all keyboards timed out wakes the display */
+    display_sleep_wake(DISPLAY_SLEEP_WAKE_KEYBOARD);
+
+    /* New entry for the keyboard select list, or its highlight moves to
+     * the followed keyboard */
+    if (new_slot || followed) {
+        ui_wake(UI_WAKE_KEYBOARDS);
+    }
+
+    if (index == selected_keyboard) {
+        schedule_display_update();
+    }
+}
+
 int scanner_msg_send_keyboard_data(const struct zmk_status_adv_data *adv_data,
                                    int8_t rssi, const char *device_name,
                                    const uint8_t *ble_addr, uint8_t ble_addr_type) {
@@ -429,11 +653,46 @@ int scanner_msg_send_keyboard_data(const struct zmk_status_adv_data *adv_data,
         return -ENOMEM;
     }
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_KEYBOARD_STORE)
+    /* Identity changes are saved soon, status changes on the long debounce */
+    const struct keyboard_state *prev = &keyboards[index];
+    bool store_identity = !prev->active ||
+        (ble_addr && memcmp(prev->ble_addr, ble_addr, sizeof(prev->ble_addr)) != 0) ||
+        (device_name && device_name[0] != '\0' &&
+         strncmp(prev->name, device_name, MAX_NAME_LEN - 1) != 0);
+    bool store_state = prev->data.active_layer != adv_data->active_layer ||
+        prev->data.battery_level != adv_data->battery_level ||
+        prev->data.profile_slot != adv_data->profile_slot ||
+        memcmp(prev->data.peripheral_battery, adv_data->peripheral_battery,
+               sizeof(adv_data->peripheral_battery)) != 0;
+#endif
+
+    /* Reception statistics (new slot starts a fresh history) */
+    uint32_t now = k_uptime_get_32();
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+    follow_detect_activity(index, adv_data, now);
+#endif
+    struct scanner_keyboard_stats *kb_stats = &keyboard_stats[index];
+    bool new_slot = !keyboards[index].active;
+    if (new_slot) {
+        memset(kb_stats, 0, sizeof(*kb_stats));
+    } else {
+        kb_stats->interval_hist[scanner_hist_bucket(now - keyboards[index].last_seen)]++;
+    }
+    kb_stats->rx_count++;
+    kb_stats->last_seen = now;
+    if (ble_addr) {
+        memcpy(kb_stats->ble_addr, ble_addr, sizeof(kb_stats->ble_addr));
+    }
+
     /* Store the data */
     keyboards[index].active = true;
     memcpy(&keyboards[index].data, adv_data, sizeof(struct zmk_status_adv_data));
     keyboards[index].rssi = rssi;
-    keyboards[index].last_seen = k_uptime_get_32();
+    keyboards[index].last_seen = now;
+    keyboards[index].hops = 0;
+    keyboards[index].last_direct = now;
+    keyboards[index].stale = false;
 
     /* Store BLE address for unique identification */
     if (ble_addr) {
@@ -448,18 +707,217 @@ int scanner_msg_send_keyboard_data(const struct zmk_status_adv_data *adv_data,
         snprintf(keyboards[index].name, MAX_NAME_LEN, "Keyboard %d", index);
     }
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+    bool followed = follow_consider_switch(index, now);
+#else
+    bool followed = false;
+#endif
+
     k_mutex_unlock(&data_mutex);
     msgs_sent++;
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_KEYBOARD_STORE)
+    if (store_identity || store_state) {
+        keyboard_store_mark_dirty(store_identity);
+    }
+#endif
+
     /* Count advertisement reception for rate calculation */
     if (index == selected_keyboard) {
         atomic_inc(&adv_receive_count);
-        schedule_display_update();
     }
 
+    scanner_notify_stored(index, adv_data, rssi, ble_addr, ble_addr_type, new_slot, followed);
+
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_RELAY)
+
+static struct scanner_relay_stats relay_stats;
+
+/*
+ * Relayed entries have lower priority than direct receptions: they are
+ * dropped while the keyboard was heard directly within the hold time, and
+ * when they carry data older than what the slot already has. last_seen is
+ * set to when the origin relay heard the keyboard, so timeouts still apply.
+ */
+int scanner_msg_send_relayed_keyboard_data(const struct zmk_status_adv_data *adv_data,
+                                           int8_t rssi, uint8_t hops, uint32_t age_ms) {
+    if (!mutex_initialized) {
+        return -EAGAIN;
+    }
+
+    if (k_mutex_lock(&data_mutex, K_MSEC(5)) != 0) {
+        msgs_dropped++;
+        return -EBUSY;
+    }
+
+    uint32_t now = k_uptime_get_32();
+    uint32_t heard_at = now - age_ms;
+    uint32_t keyboard_id = sys_get_be32(adv_data->keyboard_id);
+    int index = -1;
+
+    for (int i = 0; i < MAX_KEYBOARDS; i++) {
+        if (keyboards[i].active && sys_get_be32(keyboards[i].data.keyboard_id) == keyboard_id) {
+            index = i;
+            break;
+        }
+    }
+
+    if (index >= 0) {
+        struct keyboard_state *kb = &keyboards[index];
+        if (kb->hops == 0 && now - kb->last_direct < CONFIG_PROSPECTOR_RELAY_DIRECT_HOLD_MS) {
+            relay_stats.ignored_direct++;
+            k_mutex_unlock(&data_mutex);
+            return 0;
+        }
+        if ((int32_t)(heard_at - kb->last_seen) <= 0) {
+            relay_stats.ignored_stale++;
+            k_mutex_unlock(&data_mutex);
+            return 0;
+        }
+    } else {
+        for (int i = 0; i < MAX_KEYBOARDS; i++) {
+            if (!keyboards[i].active) {
+                index = i;
+                break;
+            }
+        }
+        if (index < 0) {
+            k_mutex_unlock(&data_mutex);
+            msgs_dropped++;
+            return -ENOMEM;
+        }
+        /* Only known through relays: no address, placeholder name */
+        memset(&keyboards[index], 0, sizeof(keyboards[index]));
+        memset(&keyboard_stats[index], 0, sizeof(keyboard_stats[index]));
+        snprintf(keyboards[index].name, MAX_NAME_LEN, "%08X", keyboard_id);
+        LOG_INF("Relayed keyboard in slot %d: ID=%08X (%u hops)", index, keyboard_id, hops);
+    }
+
+    bool new_slot = !keyboards[index].active;
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+    follow_detect_activity(index, adv_data, now);
+#endif
+
+    keyboards[index].active = true;
+    keyboards[index].data = *adv_data;
+    keyboards[index].rssi = rssi;
+    keyboards[index].hops = hops;
+    keyboards[index].stale = false;
+    keyboards[index].last_seen = heard_at;
+    relay_stats.accepted++;
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+    bool followed = follow_consider_switch(index, now);
+#else
+    bool followed = false;
+#endif
+
+    k_mutex_unlock(&data_mutex);
+    msgs_sent++;
+
+    /* No address: the stream frame carries zeros, the host keys on keyboard_id */
+    scanner_notify_stored(index, adv_data, rssi, NULL, 0, new_slot, followed);
     return 0;
 }
 
+bool scanner_get_keyboard_relay_info(int index, struct zmk_status_adv_data *data,
+                                     uint8_t *hops, uint32_t *age_ms) {
+    if (!mutex_initialized || index < 0 || index >= MAX_KEYBOARDS) {
+        return false;
+    }
+
+    if (k_mutex_lock(&data_mutex, K_MSEC(10)) != 0) {
+        return false;
+    }
+
+    /* Restored-only slots are not fresh data - never relay them */
+    bool result = keyboards[index].active && !keyboards[index].stale;
+    if (result) {
+        *data = keyboards[index].data;
+        *hops = keyboards[index].hops;
+        *age_ms = k_uptime_get_32() - keyboards[index].last_seen;
+    }
+
+    k_mutex_unlock(&data_mutex);
+    return result;
+}
+
+void scanner_get_relay_stats(struct scanner_relay_stats *stats) {
+    *stats = relay_stats;
+}
+
+#endif /* CONFIG_PROSPECTOR_RELAY */
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_KEYBOARD_STORE)
+
+bool scanner_get_saved_keyboard(int index, struct scanner_saved_keyboard *out) {
+    if (!mutex_initialized || index < 0 || index >= MAX_KEYBOARDS) {
+        return false;
+    }
+
+    if (k_mutex_lock(&data_mutex, K_MSEC(10)) != 0) {
+        return false;
+    }
+
+    const struct keyboard_state *kb = &keyboards[index];
+    bool result = kb->active && !kb->stale && kb->hops == 0;
+    if (result) {
+        memset(out, 0, sizeof(*out));
+        memcpy(out->ble_addr, kb->ble_addr, sizeof(out->ble_addr));
+        out->ble_addr_type = kb->ble_addr_type;
+        strncpy(out->name, kb->name, sizeof(out->name) - 1);
+        out->data = kb->data;
+    }
+
+    k_mutex_unlock(&data_mutex);
+    return result;
+}
+
+void scanner_restore_keyboard(int index, const struct scanner_saved_keyboard *saved) {
+    if (index < 0 || index >= MAX_KEYBOARDS) {
+        return;
+    }
+
+    if (!mutex_initialized) {
+        k_mutex_init(&data_mutex);
+        mutex_initialized = true;
+    }
+
+    k_mutex_lock(&data_mutex, K_FOREVER);
+
+    struct keyboard_state *kb = &keyboards[index];
+    if (!kb->active) {
+        memset(kb, 0, sizeof(*kb));
+        kb->active = true;
+        kb->stale = true;
+        kb->data = saved->data;
+        memcpy(kb->ble_addr, saved->ble_addr, sizeof(kb->ble_addr));
+        kb->ble_addr_type = saved->ble_addr_type;
+        strncpy(kb->name, saved->name, MAX_NAME_LEN - 1);
+        /* Times out like a keyboard last heard now */
+        kb->last_seen = k_uptime_get_32();
+        LOG_INF("Restored keyboard in slot %d: %s (stale)", index, kb->name);
+    }
+
+    k_mutex_unlock(&data_mutex);
+
+    if (index == selected_keyboard) {
+        schedule_display_update();
+    }
+}
+
+void scanner_restore_selected_keyboard(int index) {
+    if (index >= 0 && index < MAX_KEYBOARDS) {
+        selected_keyboard = index;
+        schedule_display_update();
+    }
+}
+
+#endif /* CONFIG_PROSPECTOR_KEYBOARD_STORE */
+
 int scanner_msg_send_swipe(int direction) {
     LOG_DBG("Swipe gesture: direction=%d", direction);
     msgs_sent++;
@@ -485,9 +943,11 @@ int scanner_msg_send_battery_update(void) {
     scanner_battery_level = zmk_battery_state_of_charge();
 #endif
 
-    /* Only update if we got a valid reading */
+    /* Only update if we got a valid reading - applied by the LVGL thread */
     if (scanner_battery_level > 0) {
-        display_update_scanner_battery(scanner_battery_level);
+        pending_data.scanner_battery = scanner_battery_level;
+        pending_data.scanner_battery_pending = true;
+        ui_wake(UI_WAKE_DISPLAY);
     }
 
     msgs_sent++;
@@ -524,6 +984,9 @@ int scanner_msg_send_timeout_check(void) {
                 keyboards[i].active = false;
                 keyboards[i].name[0] = '\0';
                 any_timed_out = true;
+#if IS_ENABLED(CONFIG_PROSPECTOR_USB_STREAM)
+                usb_stream_send_lost(i);
+#endif
             }
         }
     }
@@ -532,6 +995,7 @@ int scanner_msg_send_timeout_check(void) {
 
     /* Trigger display update if any keyboard timed out */
     if (any_timed_out) {
+        ui_wake(UI_WAKE_KEYBOARDS);
         schedule_display_update();
     }
 
@@ -596,16 +1060,19 @@ uint32_t scanner_msg_get_queue_count(void) {
     return k_msgq_num_used_get(&scanner_msgq);
 }
 
-/* ========== Scanner Start (delayed after boot) ========== */
+/* ========== Scanner Start (as soon as BT is ready) ========== */
 
 static void scanner_start_work_handler(struct k_work *work);
 static K_WORK_DELAYABLE_DEFINE(scanner_start_work, scanner_start_work_handler);
 
+/* System work queue, in parallel with UI construction on the display queue */
 static void scanner_start_work_handler(struct k_work *work) {
     ARG_UNUSED(work);
+
     LOG_INF("Starting BLE scanner...");
     int ret = zmk_status_scanner_start();
     if (ret == 0) {
+        boot_timing_mark(BOOT_PHASE_SCAN_START);
         LOG_INF("BLE scanner started successfully");
     } else {
         LOG_ERR("Failed to start BLE scanner: %d", ret);
@@ -614,9 +1081,29 @@ static void scanner_start_work_handler(struct k_work *work) {
     }
 }
 
+static void scanner_bt_ready(int err) {
+    if (err) {
+        LOG_ERR("Bluetooth init failed: %d", err);
+        return;
+    }
+    k_work_schedule(&scanner_start_work, K_NO_WAIT);
+}
+
 static int scanner_init_start(void) {
-    /* Schedule scanner start after 500ms to allow BLE to initialize */
-    k_work_schedule(&scanner_start_work, K_MSEC(500));
+    /* ZMK's BLE init (earlier priority) normally has BT up already */
+    if (bt_is_ready()) {
+        k_work_schedule(&scanner_start_work, K_NO_WAIT);
+        return 0;
+    }
+
+    /* Otherwise enable it here and start from the ready callback. If
+     * another owner is still enabling it, the start retries once a second */
+    int err = bt_enable(scanner_bt_ready);
+    if (err == -EALREADY) {
+        k_work_schedule(&scanner_start_work, K_NO_WAIT);
+    } else if (err) {
+        LOG_ERR("bt_enable failed: %d", err);
+    }
     return 0;
 }
 
@@ -34,3 +34,125 @@ int scanner_msg_send_keyboard_data(const struct zmk_status_adv_data *adv_data,
  * @return 0 on success, negative error code on failure
  */
 int scanner_msg_send_timeout_check(void);
+
+/* ========== Diagnostics (shell / host stream) ========== */
+
+#define SCANNER_STUB_MAX_KEYBOARDS 3
+
+/* Upper bounds (ms) of the interval/latency histogram buckets.
+ * The last bucket is open-ended. */
+#define SCANNER_HIST_BOUNDS_MS {20, 50, 100, 250, 500, 1000}
+#define SCANNER_HIST_BUCKETS 7
+
+/**
+ * @brief Per-slot reception statistics
+ */
+struct scanner_keyboard_stats {
+    uint8_t ble_addr[6];
+    uint32_t last_seen;                              /* k_uptime_get_32() of last RX */
+    uint32_t rx_count;                               /* Advertisements received */
+    uint32_t interval_hist[SCANNER_HIST_BUCKETS];    /* Inter-arrival time */
+};
+
+/**
+ * @brief Display update pipeline statistics
+ */
+struct scanner_display_stats {
+    uint32_t scheduled;                              /* Update work scheduled */
+    uint32_t coalesced;                              /* RX merged into a pending update */
+    uint32_t runs;                                   /* Work handler executions */
+    uint32_t skipped;                                /* Runs skipped (transition/Pong Wars) */
+    uint32_t latency_hist[SCANNER_HIST_BUCKETS];     /* First RX -> work handler */
+};
+
+bool scanner_get_keyboard_data(int index, struct zmk_status_adv_data *data,
+                               int8_t *rssi, char *name, size_t name_len);
+int scanner_get_selected_keyboard(void);
+
+/**
+ * @brief Get reception statistics for a keyboard slot
+ *
+ * @return true if the slot is active
+ */
+bool scanner_get_keyboard_stats(int index, struct scanner_keyboard_stats *stats);
+
+/**
+ * @brief Get display update pipeline statistics
+ */
+void scanner_get_display_stats(struct scanner_display_stats *stats);
+
+/**
+ * @brief Map a duration in ms to its histogram bucket
+ */
+int scanner_hist_bucket(uint32_t ms);
+
+/**
+ * @brief Auto-follow: show the keyboard that is currently being typed on
+ *
+ * Enabled by default when CONFIG_PROSPECTOR_AUTO_FOLLOW is set.
+ */
+void scanner_set_auto_follow(bool enabled);
+bool scanner_get_auto_follow(void);
+uint32_t scanner_get_auto_follow_switches(void);
+
+/* ========== Known-keyboard table (CONFIG_PROSPECTOR_KEYBOARD_STORE) ========== */
+
+/**
+ * @brief Persisted state of one keyboard slot
+ */
+struct scanner_saved_keyboard {
+    uint8_t ble_addr[6];
+    uint8_t ble_addr_type;
+    char name[32];
+    struct zmk_status_adv_data data;    /* Last layer, batteries, profile... */
+} __packed;
+
+/**
+ * @brief Snapshot a slot for saving
+ *
+ * @return true if the slot is active and heard since boot (not restored-only)
+ */
+bool scanner_get_saved_keyboard(int index, struct scanner_saved_keyboard *out);
+
+/**
+ * @brief Restore a slot from flash at boot
+ *
+ * The slot is shown immediately but marked stale until a packet from the
+ * keyboard arrives. It times out like any other slot if none does.
+ */
+void scanner_restore_keyboard(int index, const struct scanner_saved_keyboard *saved);
+
+/**
+ * @brief Restore the shown keyboard slot at boot
+ */
+void scanner_restore_selected_keyboard(int index);
+
+/* ========== Relay mode (CONFIG_PROSPECTOR_RELAY) ========== */
+
+struct scanner_relay_stats {
+    uint32_t accepted;        /* Relayed entries stored */
+    uint32_t ignored_direct;  /* Dropped: keyboard heard directly recently */
+    uint32_t ignored_stale;   /* Dropped: older than the data already held */
+};
+
+/**
+ * @brief Store keyboard data received through another scanner
+ *
+ * @param hops Relays between keyboard and this scanner (>= 1)
+ * @param age_ms Time since the origin relay heard the keyboard
+ */
+int scanner_msg_send_relayed_keyboard_data(const struct zmk_status_adv_data *adv_data,
+                                           int8_t rssi, uint8_t hops, uint32_t age_ms);
+
+/**
+ * @brief Get slot data with its hop count and age, for re-advertising
+ *
+ * @return true if the slot is active
+ */
+bool scanner_get_keyboard_relay_info(int index, struct zmk_status_adv_data *data,
+                                     uint8_t *hops, uint32_t *age_ms);
+
+void scanner_get_relay_stats(struct scanner_relay_stats *stats);
+
+void scanner_msg_get_stats(uint32_t *sent, uint32_t *dropped, uint32_t *processed);
+uint32_t scanner_msg_get_queue_count(void);
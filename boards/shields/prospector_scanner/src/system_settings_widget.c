@@ -8,6 +8,10 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_SETTINGS_STORE)
+#include "display_settings_store.h"
+#endif
+
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 // ========== Runtime Channel Storage ==========
@@ -38,6 +42,9 @@ void scanner_set_runtime_channel(uint8_t channel) {
     init_runtime_channel();
     runtime_scanner_channel = channel;
     LOG_INF("📡 Scanner channel set to %d (%s)", channel, channel == 0 ? "All" : "Filtered");
+#if IS_ENABLED(CONFIG_PROSPECTOR_SETTINGS_STORE)
+    display_settings_store_save_channel(channel);
+#endif
 }
 
 // Forward declaration for channel value update
@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Long-term per-keyboard telemetry logger (see telemetry_log.h for format)
+ *
+ * - BLE receive path: telemetry_log_record_rx() only updates RAM accumulators
+ * - System work queue: periodic sampling, delta encoding and FCB writes
+ * Flash is only written when the RAM batch is full or the flush interval
+ * elapses, which bounds write frequency independent of advertisement rate.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/fs/fcb.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "telemetry_log.h"
+#include "scanner_stub.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_USB_STREAM)
+#include "usb_stream.h"
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(telemetry_log, LOG_LEVEL_INF);
+
+#if !FIXED_PARTITION_EXISTS(prospector_telemetry_partition)
+#error "CONFIG_PROSPECTOR_TELEMETRY needs a 'prospector_telemetry_partition' fixed partition"
+#endif
+
+#define TELEMETRY_PARTITION_ID FIXED_PARTITION_ID(prospector_telemetry_partition)
+#define TELEMETRY_FCB_MAGIC    0x50544C47  /* "PTLG" */
+#define TELEMETRY_SLOTS        SCANNER_STUB_MAX_KEYBOARDS
+#define TELEMETRY_VALUES       5           /* battery[0..3], RSSI */
+#define VARINT_MAX             5
+
+/* tag + id + dt + mask + values + wpm + dwell mask + dwell values */
+#define TELEMETRY_MAX_RECORD_SIZE \
+    (1 + 4 + VARINT_MAX + 1 + TELEMETRY_VALUES * VARINT_MAX + VARINT_MAX + 1 + \
+     TELEMETRY_DWELL_LAYERS * VARINT_MAX)
+
+BUILD_ASSERT(CONFIG_PROSPECTOR_TELEMETRY_BATCH_SIZE >= TELEMETRY_MAX_RECORD_SIZE + 1 + VARINT_MAX,
+             "Telemetry batch too small for one record");
+
+/* Per-slot accumulator, written from the BLE receive path */
+struct telemetry_slot {
+    bool active;
+    bool new_keyboard;
+    uint32_t keyboard_id;
+    uint8_t bat[4];
+    int32_t rssi_sum;
+    uint32_t rssi_count;
+    uint8_t wpm_max;
+    uint8_t layer;
+    uint32_t layer_since;
+    uint32_t dwell_ms[TELEMETRY_DWELL_LAYERS];
+};
+
+/* Per-slot delta encoder state, reset at the start of every batch */
+struct telemetry_encoder {
+    bool keyframe_written;
+    uint32_t last_time_s;
+    int32_t last_vals[TELEMETRY_VALUES];
+};
+
+static struct telemetry_slot slots[TELEMETRY_SLOTS];
+static struct k_spinlock slots_lock;
+
+static struct telemetry_encoder encoders[TELEMETRY_SLOTS];
+static uint8_t batch[CONFIG_PROSPECTOR_TELEMETRY_BATCH_SIZE];
+static size_t batch_len = 0;
+static uint32_t batch_start_s = 0;
+static uint32_t last_flush_time = 0;
+static K_MUTEX_DEFINE(batch_mutex);
+static K_MUTEX_DEFINE(walk_mutex);  /* Serializes walkers and clear (taken before batch_mutex) */
+
+static struct fcb telemetry_fcb;
+static struct flash_sector telemetry_sectors[CONFIG_PROSPECTOR_TELEMETRY_MAX_SECTORS];
+static bool fcb_ready = false;
+
+static void telemetry_sample_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(telemetry_sample_work, telemetry_sample_work_handler);
+
+/* ========== Encoding helpers ========== */
+
+static void put_varint(uint32_t value) {
+    while (value >= 0x80) {
+        batch[batch_len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    batch[batch_len++] = (uint8_t)value;
+}
+
+static void put_zigzag(int32_t value) {
+    put_varint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+static void batch_reset(void) {
+    batch_len = 0;
+    batch_start_s = k_uptime_get_32() / 1000;
+    batch[batch_len++] = TELEMETRY_FORMAT_VERSION;
+    put_varint(batch_start_s);
+
+    for (int i = 0; i < TELEMETRY_SLOTS; i++) {
+        encoders[i].keyframe_written = false;
+    }
+}
+
+static size_t batch_header_len(void) {
+    size_t len = 2;
+    for (uint32_t v = batch_start_s; v >= 0x80; v >>= 7) {
+        len++;
+    }
+    return len;
+}
+
+/* ========== Flash (FCB) ========== */
+
+static int telemetry_write_batch(void) {
+    if (batch_len <= batch_header_len()) {
+        return 0;  /* Header only - nothing sampled */
+    }
+    if (!fcb_ready) {
+        return -ENODEV;
+    }
+
+    struct fcb_entry loc;
+    int rc = fcb_append(&telemetry_fcb, batch_len, &loc);
+    if (rc == -ENOSPC) {
+        /* Ring full - drop the oldest sector */
+        rc = fcb_rotate(&telemetry_fcb);
+        if (rc == 0) {
+            rc = fcb_append(&telemetry_fcb, batch_len, &loc);
+        }
+    }
+    if (rc == 0) {
+        rc = flash_area_write(telemetry_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), batch, batch_len);
+    }
+    if (rc == 0) {
+        rc = fcb_append_finish(&telemetry_fcb, &loc);
+    }
+
+    if (rc != 0) {
+        LOG_ERR("Telemetry write failed: %d", rc);
+    } else {
+        LOG_DBG("Telemetry batch written: %u bytes", batch_len);
+    }
+
+    last_flush_time = k_uptime_get_32();
+    batch_reset();
+    return rc;
+}
+
+int telemetry_log_flush(void) {
+    k_mutex_lock(&batch_mutex, K_FOREVER);
+    int rc = telemetry_write_batch();
+    k_mutex_unlock(&batch_mutex);
+    return rc;
+}
+
+int telemetry_log_clear(void) {
+    if (!fcb_ready) {
+        return -ENODEV;
+    }
+
+    /* Never erase sectors under a walker that is reading them */
+    k_mutex_lock(&walk_mutex, K_FOREVER);
+    k_mutex_lock(&batch_mutex, K_FOREVER);
+    int rc = fcb_clear(&telemetry_fcb);
+    batch_reset();
+    k_mutex_unlock(&batch_mutex);
+    k_mutex_unlock(&walk_mutex);
+    return rc;
+}
+
+/*
+ * Entries are stepped with fcb_getnext(), which holds the FCB lock only
+ * while locating the next entry. Each batch is copied out before the
+ * callback runs, so a slow callback (shell output, paced streaming) never
+ * blocks sampling or flushing on the system work queue.
+ */
+int telemetry_log_walk(telemetry_log_entry_cb_t cb, void *user_data) {
+    if (!fcb_ready) {
+        return -ENODEV;
+    }
+
+    static uint8_t buf[CONFIG_PROSPECTOR_TELEMETRY_BATCH_SIZE];
+    struct fcb_entry loc = {0};
+    int rc = 0;
+
+    k_mutex_lock(&walk_mutex, K_FOREVER);
+    while (fcb_getnext(&telemetry_fcb, &loc) == 0) {
+        uint16_t len = MIN(loc.fe_data_len, sizeof(buf));
+
+        rc = flash_area_read(telemetry_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), buf, len);
+        if (rc == 0) {
+            rc = cb(buf, len, user_data);
+        }
+        if (rc != 0) {
+            break;
+        }
+    }
+    k_mutex_unlock(&walk_mutex);
+    return rc;
+}
+
+/* ========== Receive path ========== */
+
+void telemetry_log_record_rx(int slot, const struct zmk_status_adv_data *data, int8_t rssi) {
+    if (slot < 0 || slot >= TELEMETRY_SLOTS) {
+        return;
+    }
+
+    uint32_t id = sys_get_be32(data->keyboard_id);
+    uint32_t now = k_uptime_get_32();
+    k_spinlock_key_t key = k_spin_lock(&slots_lock);
+    struct telemetry_slot *s = &slots[slot];
+
+    if (!s->active || s->keyboard_id != id) {
+        /* Different keyboard in this slot - start a fresh series */
+        memset(s, 0, sizeof(*s));
+        s->active = true;
+        s->new_keyboard = true;
+        s->keyboard_id = id;
+        s->layer = data->active_layer;
+        s->layer_since = now;
+    }
+
+    if (data->active_layer != s->layer) {
+        s->dwell_ms[MIN(s->layer, TELEMETRY_DWELL_LAYERS - 1)] += now - s->layer_since;
+        s->layer = data->active_layer;
+        s->layer_since = now;
+    }
+
+    s->bat[0] = data->battery_level;
+    memcpy(&s->bat[1], data->peripheral_battery, 3);
+    s->rssi_sum += rssi;
+    s->rssi_count++;
+    s->wpm_max = MAX(s->wpm_max, data->wpm_value);
+
+    k_spin_unlock(&slots_lock, key);
+}
+
+/* ========== Sampling (system work queue) ========== */
+
+static void telemetry_encode_sample(int slot, const struct telemetry_slot *snap, uint32_t now_s) {
+    struct telemetry_encoder *enc = &encoders[slot];
+    bool keyframe = !enc->keyframe_written || snap->new_keyboard;
+
+    int32_t vals[TELEMETRY_VALUES] = {
+        snap->bat[0], snap->bat[1], snap->bat[2], snap->bat[3],
+        snap->rssi_sum / snap->rssi_count,
+    };
+
+    batch[batch_len++] = (keyframe ? 0x80 : 0x00) | (slot & 0x07);
+    if (keyframe) {
+        sys_put_be32(snap->keyboard_id, &batch[batch_len]);
+        batch_len += 4;
+        enc->last_time_s = batch_start_s;
+        memset(enc->last_vals, 0, sizeof(enc->last_vals));
+    }
+
+    put_varint(now_s - enc->last_time_s);
+    enc->last_time_s = now_s;
+
+    uint8_t mask = 0;
+    for (int i = 0; i < TELEMETRY_VALUES; i++) {
+        if (keyframe || vals[i] != enc->last_vals[i]) {
+            mask |= BIT(i);
+        }
+    }
+    batch[batch_len++] = mask;
+    for (int i = 0; i < TELEMETRY_VALUES; i++) {
+        if (mask & BIT(i)) {
+            put_zigzag(vals[i] - enc->last_vals[i]);
+            enc->last_vals[i] = vals[i];
+        }
+    }
+
+    put_varint(snap->wpm_max);
+
+    uint8_t dwell_mask = 0;
+    for (int i = 0; i < TELEMETRY_DWELL_LAYERS; i++) {
+        if (snap->dwell_ms[i] >= 500) {
+            dwell_mask |= BIT(i);
+        }
+    }
+    batch[batch_len++] = dwell_mask;
+    for (int i = 0; i < TELEMETRY_DWELL_LAYERS; i++) {
+        if (dwell_mask & BIT(i)) {
+            put_varint((snap->dwell_ms[i] + 500) / 1000);
+        }
+    }
+
+    enc->keyframe_written = true;
+}
+
+static void telemetry_sample_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    uint32_t now = k_uptime_get_32();
+    uint32_t now_s = now / 1000;
+
+    k_mutex_lock(&batch_mutex, K_FOREVER);
+
+    for (int i = 0; i < TELEMETRY_SLOTS; i++) {
+        struct telemetry_slot snap;
+
+        /* Snapshot and reset the interval accumulators */
+        k_spinlock_key_t key = k_spin_lock(&slots_lock);
+        struct telemetry_slot *s = &slots[i];
+        if (s->active) {
+            s->dwell_ms[MIN(s->layer, TELEMETRY_DWELL_LAYERS - 1)] += now - s->layer_since;
+            s->layer_since = now;
+        }
+        snap = *s;
+        s->new_keyboard = false;
+        s->rssi_sum = 0;
+        s->rssi_count = 0;
+        s->wpm_max = 0;
+        memset(s->dwell_ms, 0, sizeof(s->dwell_ms));
+        k_spin_unlock(&slots_lock, key);
+
+        /* Nothing received during this interval - keyboard away or asleep */
+        if (!snap.active || snap.rssi_count == 0) {
+            continue;
+        }
+
+        if (batch_len + TELEMETRY_MAX_RECORD_SIZE > sizeof(batch)) {
+            telemetry_write_batch();
+        }
+        telemetry_encode_sample(i, &snap, now_s);
+    }
+
+    if ((now - last_flush_time) >= CONFIG_PROSPECTOR_TELEMETRY_FLUSH_INTERVAL_MIN * 60000U) {
+        telemetry_write_batch();
+    }
+
+    k_mutex_unlock(&batch_mutex);
+
+    k_work_schedule(&telemetry_sample_work, K_SECONDS(CONFIG_PROSPECTOR_TELEMETRY_SAMPLE_INTERVAL_S));
+}
+
+static int telemetry_log_init(void) {
+    uint32_t sector_cnt = ARRAY_SIZE(telemetry_sectors);
+    int rc = flash_area_get_sectors(TELEMETRY_PARTITION_ID, &sector_cnt, telemetry_sectors);
+    if (rc != 0) {
+        LOG_ERR("Telemetry partition sectors unavailable: %d", rc);
+        return 0;
+    }
+
+    telemetry_fcb.f_magic = TELEMETRY_FCB_MAGIC;
+    telemetry_fcb.f_version = TELEMETRY_FORMAT_VERSION;
+    telemetry_fcb.f_sector_cnt = sector_cnt;
+    telemetry_fcb.f_scratch_cnt = 0;
+    telemetry_fcb.f_sectors = telemetry_sectors;
+
+    rc = fcb_init(TELEMETRY_PARTITION_ID, &telemetry_fcb);
+    if (rc != 0) {
+        LOG_ERR("Telemetry FCB init failed: %d", rc);
+        return 0;
+    }
+
+    fcb_ready = true;
+    last_flush_time = k_uptime_get_32();
+    batch_reset();
+
+    k_work_schedule(&telemetry_sample_work, K_SECONDS(CONFIG_PROSPECTOR_TELEMETRY_SAMPLE_INTERVAL_S));
+
+    LOG_INF("Telemetry logger ready: %u sectors, sample %us, flush %umin",
+            sector_cnt, CONFIG_PROSPECTOR_TELEMETRY_SAMPLE_INTERVAL_S,
+            CONFIG_PROSPECTOR_TELEMETRY_FLUSH_INTERVAL_MIN);
+    return 0;
+}
+
+SYS_INIT(telemetry_log_init, APPLICATION, 96);
+
+/* ========== Shell: prospector telemetry dump|stream|flush|clear ========== */
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+struct telemetry_reader {
+    const uint8_t *buf;
+    size_t len;
+    size_t pos;
+    bool error;
+};
+
+static uint8_t get_u8(struct telemetry_reader *r) {
+    if (r->pos >= r->len) {
+        r->error = true;
+        return 0;
+    }
+    return r->buf[r->pos++];
+}
+
+static uint32_t get_varint(struct telemetry_reader *r) {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 7 * VARINT_MAX; shift += 7) {
+        uint8_t b = get_u8(r);
+        value |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+    return value;
+}
+
+static int32_t get_zigzag(struct telemetry_reader *r) {
+    uint32_t v = get_varint(r);
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+static int telemetry_dump_cb(const uint8_t *buf, size_t len, void *user_data) {
+    const struct shell *sh = user_data;
+    struct telemetry_reader r = {.buf = buf, .len = len};
+    struct {
+        bool valid;
+        uint32_t id;
+        uint32_t time_s;
+        int32_t vals[TELEMETRY_VALUES];
+    } dec[8] = {0};
+
+    if (get_u8(&r) != TELEMETRY_FORMAT_VERSION) {
+        shell_warn(sh, "Unknown telemetry batch version");
+        return 0;
+    }
+    uint32_t base_s = get_varint(&r);
+    shell_print(sh, "-- batch at uptime %us (%u bytes)", base_s, len);
+
+    while (r.pos < r.len && !r.error) {
+        uint8_t tag = get_u8(&r);
+        int slot = tag & 0x07;
+
+        if (tag & 0x80) {
+            if (r.pos + 4 > r.len) {
+                r.error = true;
+                break;
+            }
+            dec[slot].valid = true;
+            dec[slot].id = sys_get_be32(&r.buf[r.pos]);
+            r.pos += 4;
+            dec[slot].time_s = base_s;
+            memset(dec[slot].vals, 0, sizeof(dec[slot].vals));
+        } else if (!dec[slot].valid) {
+            shell_warn(sh, "Delta record without keyframe - batch corrupt");
+            return 0;
+        }
+
+        dec[slot].time_s += get_varint(&r);
+        uint8_t mask = get_u8(&r);
+        for (int i = 0; i < TELEMETRY_VALUES; i++) {
+            if (mask & BIT(i)) {
+                dec[slot].vals[i] += get_zigzag(&r);
+            }
+        }
+        uint32_t wpm = get_varint(&r);
+
+        char dwell[8 * 12] = "";
+        int dwell_pos = 0;
+        uint8_t dwell_mask = get_u8(&r);
+        for (int i = 0; i < TELEMETRY_DWELL_LAYERS; i++) {
+            if (dwell_mask & BIT(i)) {
+                dwell_pos += snprintf(dwell + dwell_pos, sizeof(dwell) - dwell_pos,
+                                      " L%d:%us", i, get_varint(&r));
+            }
+        }
+
+        if (r.pos > r.len) {
+            r.error = true;
+            break;
+        }
+
+        shell_print(sh, "%6us kb=%08X bat=%d/%d/%d/%d rssi=%d wpm=%u%s",
+                    dec[slot].time_s, dec[slot].id,
+                    dec[slot].vals[0], dec[slot].vals[1], dec[slot].vals[2], dec[slot].vals[3],
+                    dec[slot].vals[4], wpm, dwell);
+    }
+
+    if (r.error) {
+        shell_warn(sh, "Truncated telemetry batch");
+    }
+    return 0;
+}
+
+static int cmd_telemetry_dump(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int rc = telemetry_log_walk(telemetry_dump_cb, (void *)sh);
+    if (rc < 0) {
+        shell_error(sh, "Telemetry read failed: %d", rc);
+    }
+    return rc;
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_USB_STREAM)
+static int telemetry_stream_cb(const uint8_t *buf, size_t len, void *user_data) {
+    ARG_UNUSED(user_data);
+    usb_stream_send_telemetry(buf, len);
+    /* Let the stream drain between batches instead of overflowing its ring.
+     * The batch is a copy - no FCB lock is held while sleeping. */
+    k_sleep(K_MSEC(CONFIG_PROSPECTOR_USB_STREAM_FLUSH_MS * 2));
+    return 0;
+}
+
+static int cmd_telemetry_stream(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int rc = telemetry_log_walk(telemetry_stream_cb, NULL);
+    shell_print(sh, "Telemetry streamed (%d)", rc);
+    return rc;
+}
+#endif
+
+static int cmd_telemetry_flush(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int rc = telemetry_log_flush();
+    shell_print(sh, "Telemetry flush: %d", rc);
+    return rc;
+}
+
+static int cmd_telemetry_clear(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    int rc = telemetry_log_clear();
+    shell_print(sh, "Telemetry cleared: %d", rc);
+    return rc;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(telemetry_cmds,
+    SHELL_CMD(dump, NULL, "Decode and print stored telemetry", cmd_telemetry_dump),
+#if IS_ENABLED(CONFIG_PROSPECTOR_USB_STREAM)
+    SHELL_CMD(stream, NULL, "Send raw telemetry batches over the status stream",
+              cmd_telemetry_stream),
+#endif
+    SHELL_CMD(flush, NULL, "Write pending samples to flash now", cmd_telemetry_flush),
+    SHELL_CMD(clear, NULL, "Erase stored telemetry", cmd_telemetry_clear),
+    SHELL_SUBCMD_SET_END);
+
+SHELL_SUBCMD_ADD((prospector), telemetry, &telemetry_cmds, "Long-term keyboard telemetry",
+                 NULL, 1, 0);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Long-term per-keyboard telemetry (battery, WPM, layer dwell, RSSI)
+ *
+ * Samples are delta-encoded into a RAM batch and appended to an FCB ring
+ * on the "prospector_telemetry_partition" fixed partition. FCB overwrites
+ * the oldest sector when full, so wear is spread across the partition.
+ *
+ * Batch (one FCB entry) layout:
+ *   [version][varint: uptime seconds at batch start] then records:
+ *   [tag]                bit7 = keyframe, bits0-2 = slot
+ *   [keyboard_id x4]     keyframe only
+ *   [varint: dt]         seconds since previous record of this slot
+ *                        (keyframe: since batch start)
+ *   [change mask]        bit0-3 battery[0..3], bit4 RSSI
+ *   [zigzag varint...]   one per set mask bit, delta vs previous record
+ *                        (keyframe: delta vs 0, mask = 0x1F)
+ *   [varint: wpm max]    highest WPM seen during the interval
+ *   [dwell mask]         bit n = layer n has dwell time (layers >= 7 -> bit 7)
+ *   [varint: seconds...] one per set dwell bit
+ *
+ * Every batch starts with a keyframe per slot, so each entry decodes alone.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zmk/status_advertisement.h>
+
+#define TELEMETRY_FORMAT_VERSION 1
+#define TELEMETRY_DWELL_LAYERS   8
+
+/**
+ * @brief Feed one received advertisement into the per-slot accumulator
+ *
+ * Called from the BLE receive path - only updates RAM counters.
+ */
+void telemetry_log_record_rx(int slot, const struct zmk_status_adv_data *data, int8_t rssi);
+
+/**
+ * @brief Write the pending batch to flash now
+ *
+ * @return 0 on success (or nothing to write), negative error code on failure
+ */
+int telemetry_log_flush(void);
+
+/**
+ * @brief Erase all stored telemetry
+ */
+int telemetry_log_clear(void);
+
+/**
+ * @brief Callback for each stored batch, oldest first
+ *
+ * @return 0 to continue, non-zero to stop
+ */
+typedef int (*telemetry_log_entry_cb_t)(const uint8_t *buf, size_t len, void *user_data);
+
+/**
+ * @brief Iterate over all stored batches
+ *
+ * The callback gets a copy of each batch and runs without the FCB lock
+ * held, so it may block. Batches appended during the walk are included.
+ */
+int telemetry_log_walk(telemetry_log_entry_cb_t cb, void *user_data);
@@ -6,6 +6,9 @@
 
 #include "touch_handler.h"
 #include "events/swipe_gesture_event.h"
+#include "ui_wake.h"
+#include "display_sleep.h"
+#include "panel_idle.h"
 // Message queue removed - using ZMK event system for thread-safe architecture
 
 /* Weak function - overridden by display_settings_widget.c when included */
@@ -143,6 +146,7 @@ static void touch_input_callback(struct input_event *evt, void *user_data) {
             // Store X coordinate
             current_x = (uint16_t)evt->value;
             x_updated = true;
+            ui_wake(UI_WAKE_TOUCH);  // Drag: LVGL reads the new position
             LOG_INF("📍 X: %d", current_x);
             break;
 
@@ -150,12 +154,18 @@ static void touch_input_callback(struct input_event *evt, void *user_data) {
             // Store Y coordinate
             current_y = (uint16_t)evt->value;
             y_updated = true;
+            ui_wake(UI_WAKE_TOUCH);
             LOG_INF("📍 Y: %d", current_y);
             break;
 
         case INPUT_BTN_TOUCH:
             // Touch state changed
             touch_active = (evt->value != 0);
+            display_sleep_wake(DISPLAY_SLEEP_WAKE_TOUCH);
+            if (touch_active) {
+                panel_idle_note_activity();  // Undim the dashboard on press
+            }
+            ui_wake(UI_WAKE_TOUCH);
             LOG_INF("🔔 BTN_TOUCH event: value=%d, prev_active=%d, new_active=%d",
                     evt->value, prev_touch_active, touch_active);
 
@@ -248,7 +258,6 @@ INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(TOUCH_NODE), touch_input_callback, NULL);
 // - Touch Y (0-279) → Display X (0-279) - direct mapping, NO inversion
 // - Touch X (0-239) → Display Y (239-0) - inverted
 static void lvgl_input_read(lv_indev_t *indev, lv_indev_data_t *data) {
-    ARG_UNUSED(indev);
 
     // Transform coordinates: swap X/Y axes
     // Touch panel Y axis maps to display X axis (direct, no inversion)
@@ -266,6 +275,10 @@ static void lvgl_input_read(lv_indev_t *indev, lv_indev_data_t *data) {
     data->point.y = logical_y;
     data->state = touch_active ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
 
+    // Long press, press repeat and scroll throw need reads every refresh
+    // period; only fall back to report-driven reads once the indev is idle
+    ui_wake_hold(UI_WAKE_TOUCH, touch_active || lv_indev_get_scroll_obj(indev) != NULL);
+
     // Debug: Log when LVGL reads touch state (reduced frequency)
     static uint32_t last_log_time = 0;
     uint32_t now = k_uptime_get_32();
@@ -310,6 +323,9 @@ int touch_handler_register_lvgl_indev(void) {
     lv_indev_set_type(lvgl_indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(lvgl_indev, lvgl_input_read);
 
+    // Read on touch reports instead of every LV_DEF_REFR_PERIOD while idle
+    ui_wake_bind(UI_WAKE_TOUCH, lv_indev_get_read_timer(lvgl_indev), LV_DEF_REFR_PERIOD);
+
     LOG_INF("LVGL input device registered for touch events");
 
     return 0;
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Diff-aware widget setters (see ui_bind.h)
+ *
+ * Invalidated pixels are counted from the display's INVALIDATE_AREA event,
+ * i.e. after LVGL has clipped the area to the screen but before areas are
+ * joined, which is the amount of redraw work the updates requested.
+ * "prospector ui diff off" turns the comparisons off so the before/after
+ * pixel rate can be measured on the same device and keyboard traffic.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui_bind.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(ui_bind, LOG_LEVEL_INF);
+
+static volatile bool diff_enabled = true;
+static uint32_t stat_applied;
+static uint32_t stat_skipped;
+static uint64_t stat_inv_px;
+static uint32_t stat_inv_areas;
+static uint32_t stat_start_ms;
+static bool inv_hook_registered = false;
+
+/* Count the call and tell the caller whether to apply it */
+static bool ui_bind_changed(bool differs) {
+    if (differs || !diff_enabled) {
+        stat_applied++;
+        return true;
+    }
+    stat_skipped++;
+    return false;
+}
+
+bool ui_bind_label_text(lv_obj_t *label, const char *text) {
+    if (!label || !text) {
+        return false;
+    }
+    const char *cur = lv_label_get_text(label);
+    if (!ui_bind_changed(!cur || strcmp(cur, text) != 0)) {
+        return false;
+    }
+    lv_label_set_text(label, text);
+    return true;
+}
+
+bool ui_bind_label_fmt(lv_obj_t *label, const char *fmt, ...) {
+    char buf[64];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    return ui_bind_label_text(label, buf);
+}
+
+void ui_bind_opa(lv_obj_t *obj, lv_opa_t opa, lv_style_selector_t selector) {
+    if (obj && ui_bind_changed(lv_obj_get_style_opa(obj, lv_obj_style_get_selector_part(selector)) != opa)) {
+        lv_obj_set_style_opa(obj, opa, selector);
+    }
+}
+
+void ui_bind_text_opa(lv_obj_t *obj, lv_opa_t opa, lv_style_selector_t selector) {
+    if (obj && ui_bind_changed(lv_obj_get_style_text_opa(obj, lv_obj_style_get_selector_part(selector)) != opa)) {
+        lv_obj_set_style_text_opa(obj, opa, selector);
+    }
+}
+
+void ui_bind_text_color(lv_obj_t *obj, lv_color_t color, lv_style_selector_t selector) {
+    if (obj && ui_bind_changed(!lv_color_eq(
+                   lv_obj_get_style_text_color(obj, lv_obj_style_get_selector_part(selector)), color))) {
+        lv_obj_set_style_text_color(obj, color, selector);
+    }
+}
+
+void ui_bind_bg_color(lv_obj_t *obj, lv_color_t color, lv_style_selector_t selector) {
+    if (obj && ui_bind_changed(!lv_color_eq(
+                   lv_obj_get_style_bg_color(obj, lv_obj_style_get_selector_part(selector)), color))) {
+        lv_obj_set_style_bg_color(obj, color, selector);
+    }
+}
+
+void ui_bind_bar_value(lv_obj_t *bar, int32_t value) {
+    if (bar && ui_bind_changed(lv_bar_get_value(bar) != value)) {
+        lv_bar_set_value(bar, value, LV_ANIM_OFF);
+    }
+}
+
+void ui_bind_pos(lv_obj_t *obj, int32_t x, int32_t y) {
+    if (obj && ui_bind_changed(lv_obj_get_style_x(obj, LV_PART_MAIN) != x ||
+                               lv_obj_get_style_y(obj, LV_PART_MAIN) != y)) {
+        lv_obj_set_pos(obj, x, y);
+    }
+}
+
+static void ui_bind_invalidate_cb(lv_event_t *e) {
+    const lv_area_t *area = lv_event_get_param(e);
+    if (area) {
+        stat_inv_px += lv_area_get_size(area);
+        stat_inv_areas++;
+    }
+}
+
+void ui_bind_init(void) {
+    if (inv_hook_registered) {
+        return;
+    }
+    lv_display_t *disp = lv_display_get_default();
+    if (!disp) {
+        return;
+    }
+    lv_display_add_event_cb(disp, ui_bind_invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    inv_hook_registered = true;
+    stat_start_ms = k_uptime_get_32();
+}
+
+void ui_bind_get_stats(struct ui_bind_stats *stats) {
+    stats->diff_enabled = diff_enabled;
+    stats->applied = stat_applied;
+    stats->skipped = stat_skipped;
+    stats->invalidated_px = stat_inv_px;
+    stats->invalidated_areas = stat_inv_areas;
+    stats->window_ms = k_uptime_get_32() - stat_start_ms;
+}
+
+void ui_bind_reset_stats(void) {
+    stat_applied = 0;
+    stat_skipped = 0;
+    stat_inv_px = 0;
+    stat_inv_areas = 0;
+    stat_start_ms = k_uptime_get_32();
+}
+
+void ui_bind_set_diff_enabled(bool enabled) {
+    diff_enabled = enabled;
+    LOG_INF("Diff-aware widget updates %s", enabled ? "enabled" : "disabled");
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static int cmd_ui(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2 && strcmp(argv[1], "reset") == 0) {
+        ui_bind_reset_stats();
+        shell_print(sh, "UI counters reset");
+        return 0;
+    }
+    if (argc >= 3 && strcmp(argv[1], "diff") == 0) {
+        ui_bind_set_diff_enabled(strcmp(argv[2], "on") == 0);
+        ui_bind_reset_stats();
+    }
+
+    struct ui_bind_stats st;
+    ui_bind_get_stats(&st);
+    uint32_t secs = MAX(st.window_ms / 1000, 1);
+
+    shell_print(sh, "Diff-aware updates: %s (over %u s)", st.diff_enabled ? "on" : "off",
+                st.window_ms / 1000);
+    shell_print(sh, "Setters: applied=%u skipped=%u", st.applied, st.skipped);
+    shell_print(sh, "Invalidated: %u px/s, %u areas/s", (uint32_t)(st.invalidated_px / secs),
+                st.invalidated_areas / secs);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), ui, NULL,
+                 "Widget update counters [reset | diff on|off]", cmd_ui, 1, 2);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Diff-aware widget setters
+ *
+ * Every LVGL setter below invalidates the object (redraw + SPI flush)
+ * even when the new value equals the current one. These wrappers compare
+ * against the value the widget already holds and skip no-op updates, so
+ * the status screen can call its display_update_*() functions freely.
+ * The widget itself is the cache, which keeps the comparison correct
+ * when widgets are destroyed and recreated on screen transitions.
+ *
+ * LVGL thread only, like any other LVGL call.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+/** @return true if the label text was changed */
+bool ui_bind_label_text(lv_obj_t *label, const char *text);
+
+/** printf-style variant of ui_bind_label_text() (max 63 chars) */
+bool ui_bind_label_fmt(lv_obj_t *label, const char *fmt, ...);
+
+void ui_bind_opa(lv_obj_t *obj, lv_opa_t opa, lv_style_selector_t selector);
+void ui_bind_text_opa(lv_obj_t *obj, lv_opa_t opa, lv_style_selector_t selector);
+void ui_bind_text_color(lv_obj_t *obj, lv_color_t color, lv_style_selector_t selector);
+void ui_bind_bg_color(lv_obj_t *obj, lv_color_t color, lv_style_selector_t selector);
+void ui_bind_pos(lv_obj_t *obj, int32_t x, int32_t y);
+void ui_bind_bar_value(lv_obj_t *bar, int32_t value);  /* LV_ANIM_OFF */
+
+/**
+ * @brief Start counting invalidated pixels on the default display
+ *
+ * Call once after the display exists (status screen creation).
+ */
+void ui_bind_init(void);
+
+struct ui_bind_stats {
+    bool diff_enabled;         /* false = setters always apply (baseline) */
+    uint32_t applied;          /* Setter calls that changed the widget */
+    uint32_t skipped;          /* No-op setter calls skipped */
+    uint64_t invalidated_px;   /* Pixels invalidated on the display */
+    uint32_t invalidated_areas;
+    uint32_t window_ms;        /* Time since the counters were reset */
+};
+
+void ui_bind_get_stats(struct ui_bind_stats *stats);
+void ui_bind_reset_stats(void);
+
+/** Disable to measure the baseline (every update invalidates) */
+void ui_bind_set_diff_enabled(bool enabled);
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Event-driven wakeups of LVGL timers (see ui_wake.h)
+ *
+ * LVGL runs on ZMK's display work queue (display tick work). The wake
+ * work is submitted to the same queue, so readying timers and calling
+ * lv_timer_handler() from it never races the regular tick. Pending
+ * sources are an atomic bitmask: a burst of signals costs one wakeup.
+ *
+ * Latency is measured from the first signal of a burst to the start of
+ * the wake work. Idle runs are bound-timer callbacks that found nothing
+ * to do - with polling that is nearly every run, with wakeups only the
+ * fallback period. "prospector wake off" switches back to polling so both
+ * can be compared on the same device.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <string.h>
+#include <zmk/display.h>
+
+#include "ui_wake.h"
+#include "display_sched.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(ui_wake, LOG_LEVEL_INF);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_UI_WAKE)
+#define UI_WAKE_FALLBACK_MS CONFIG_PROSPECTOR_UI_WAKE_FALLBACK_MS
+#else
+#define UI_WAKE_FALLBACK_MS 0
+#endif
+
+struct ui_wake_stat {
+    uint32_t signals;    /* ui_wake() calls */
+    uint32_t wakeups;    /* Wake work runs that handled this source */
+    uint32_t runs;       /* Bound timer callback runs */
+    uint32_t idle_runs;  /* ...that found nothing to do */
+    uint32_t latency_us_max;
+    uint64_t latency_us_total;
+};
+
+static ATOMIC_DEFINE(wake_pending, UI_WAKE_COUNT);
+static uint32_t wake_signal_cyc[UI_WAKE_COUNT];  /* First signal of the pending burst */
+static lv_timer_t *wake_timers[UI_WAKE_COUNT];
+static uint32_t wake_poll_ms[UI_WAKE_COUNT];
+static bool wake_held[UI_WAKE_COUNT];  /* Polling at poll_ms until released */
+static struct ui_wake_stat wake_stats[UI_WAKE_COUNT];
+static uint32_t wake_stats_start_ms;
+static volatile bool wake_enabled = IS_ENABLED(CONFIG_PROSPECTOR_UI_WAKE);
+
+static void ui_wake_work_handler(struct k_work *work);
+static K_WORK_DEFINE(ui_wake_work, ui_wake_work_handler);
+
+static void ui_wake_apply_period_handler(struct k_work *work);
+static K_WORK_DEFINE(ui_wake_apply_period_work, ui_wake_apply_period_handler);
+
+static void ui_wake_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    uint32_t now = k_cycle_get_32();
+    bool ready = false;
+
+    for (int i = 0; i < UI_WAKE_COUNT; i++) {
+        if (!atomic_test_and_clear_bit(wake_pending, i)) {
+            continue;
+        }
+        struct ui_wake_stat *st = &wake_stats[i];
+        uint32_t us = k_cyc_to_us_floor32(now - wake_signal_cyc[i]);
+        st->wakeups++;
+        st->latency_us_total += us;
+        st->latency_us_max = MAX(st->latency_us_max, us);
+
+        if (wake_timers[i]) {
+            lv_timer_ready(wake_timers[i]);
+            ready = true;
+        }
+    }
+
+    /* Run the readied timers now instead of on the next display tick */
+    if (ready) {
+        if (IS_ENABLED(CONFIG_PROSPECTOR_TICKLESS_DISPLAY)) {
+            display_sched_kick();
+        } else {
+            lv_timer_handler();
+        }
+    }
+}
+
+void ui_wake(enum ui_wake_source source) {
+    if (source >= UI_WAKE_COUNT) {
+        return;
+    }
+    wake_stats[source].signals++;
+    if (!wake_enabled) {
+        return;
+    }
+    if (!atomic_test_and_set_bit(wake_pending, source)) {
+        wake_signal_cyc[source] = k_cycle_get_32();
+    }
+    k_work_submit_to_queue(zmk_display_work_q(), &ui_wake_work);
+}
+
+static uint32_t ui_wake_period(enum ui_wake_source source) {
+    return (wake_enabled && !wake_held[source]) ? UI_WAKE_FALLBACK_MS : wake_poll_ms[source];
+}
+
+void ui_wake_bind(enum ui_wake_source source, lv_timer_t *timer, uint32_t poll_ms) {
+    if (source >= UI_WAKE_COUNT) {
+        return;
+    }
+    wake_timers[source] = timer;
+    wake_poll_ms[source] = poll_ms;
+    if (timer) {
+        lv_timer_set_period(timer, ui_wake_period(source));
+        lv_timer_ready(timer);
+    }
+}
+
+void ui_wake_hold(enum ui_wake_source source, bool hold) {
+    if (source >= UI_WAKE_COUNT || wake_held[source] == hold) {
+        return;
+    }
+    wake_held[source] = hold;
+    if (wake_timers[source]) {
+        lv_timer_set_period(wake_timers[source], ui_wake_period(source));
+    }
+}
+
+void ui_wake_count_run(enum ui_wake_source source, bool idle) {
+    if (source >= UI_WAKE_COUNT) {
+        return;
+    }
+    wake_stats[source].runs++;
+    if (idle) {
+        wake_stats[source].idle_runs++;
+    }
+}
+
+/* Timer periods are changed in the LVGL thread */
+static void ui_wake_apply_period_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    for (int i = 0; i < UI_WAKE_COUNT; i++) {
+        if (wake_timers[i]) {
+            lv_timer_set_period(wake_timers[i], ui_wake_period(i));
+        }
+    }
+}
+
+void ui_wake_set_enabled(bool enabled) {
+    if (!IS_ENABLED(CONFIG_PROSPECTOR_UI_WAKE)) {
+        return;
+    }
+    wake_enabled = enabled;
+    k_work_submit_to_queue(zmk_display_work_q(), &ui_wake_apply_period_work);
+    LOG_INF("Event-driven UI wakeups %s", enabled ? "enabled" : "disabled");
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static const char *const source_names[UI_WAKE_COUNT] = {
+    [UI_WAKE_SWIPE] = "swipe",
+    [UI_WAKE_DISPLAY] = "display",
+    [UI_WAKE_KEYBOARDS] = "keyboards",
+    [UI_WAKE_BRIGHTNESS] = "brightness",
+    [UI_WAKE_TOUCH] = "touch",
+};
+
+/* Shell runs outside the LVGL thread: counters are read without locking */
+static int cmd_wake(const struct shell *sh, size_t argc, char **argv) {
+    if (argc >= 2) {
+        if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0) {
+            if (!IS_ENABLED(CONFIG_PROSPECTOR_UI_WAKE)) {
+                shell_error(sh, "Built without CONFIG_PROSPECTOR_UI_WAKE");
+                return -ENOTSUP;
+            }
+            ui_wake_set_enabled(strcmp(argv[1], "on") == 0);
+        } else if (strcmp(argv[1], "reset") != 0) {
+            shell_error(sh, "Usage: prospector wake [on|off|reset]");
+            return -EINVAL;
+        }
+        memset(wake_stats, 0, sizeof(wake_stats));
+        wake_stats_start_ms = k_uptime_get_32();
+        shell_print(sh, "Wake counters reset");
+        return 0;
+    }
+
+    uint32_t window_ms = k_uptime_get_32() - wake_stats_start_ms;
+    uint32_t secs = MAX(window_ms / 1000, 1);
+    uint32_t total_runs = 0;
+
+    shell_print(sh, "UI wakeups: %s (fallback %u ms), over %u s",
+                wake_enabled ? "event-driven" : "polling", UI_WAKE_FALLBACK_MS, window_ms / 1000);
+    shell_print(sh, "%-10s %8s %8s %8s %8s %9s %9s", "source", "signals", "wakeups", "runs",
+                "idle", "avg(us)", "max(us)");
+    for (int i = 0; i < UI_WAKE_COUNT; i++) {
+        const struct ui_wake_stat *st = &wake_stats[i];
+        uint32_t avg = st->wakeups ? (uint32_t)(st->latency_us_total / st->wakeups) : 0;
+        shell_print(sh, "%-10s %8u %8u %8u %8u %9u %9u", source_names[i], st->signals,
+                    st->wakeups, st->runs, st->idle_runs, avg, st->latency_us_max);
+        total_runs += st->runs;
+    }
+    shell_print(sh, "Timer runs: %u/s", total_runs / secs);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), wake, NULL, "Event-driven UI wakeups [on|off|reset]", cmd_wake,
+                 1, 1);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
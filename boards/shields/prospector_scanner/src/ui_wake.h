@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Event-driven wakeups of LVGL timers
+ *
+ * Producers outside the LVGL thread (scanner work queue, swipe listener,
+ * light sensor work) signal a source instead of waiting for a polling
+ * timer to notice their flag. The bound LVGL timer is made ready and
+ * LVGL's timer handler runs right away on the display work queue, so the
+ * timer itself only needs a long fallback period.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <lvgl.h>
+
+enum ui_wake_source {
+    UI_WAKE_SWIPE,       /* Swipe gesture queued */
+    UI_WAKE_DISPLAY,     /* Keyboard, signal or scanner battery data pending */
+    UI_WAKE_KEYBOARDS,   /* Keyboard appeared or timed out */
+    UI_WAKE_BRIGHTNESS,  /* Ambient light sample due */
+    UI_WAKE_TOUCH,       /* Touch panel report (LVGL indev read) */
+    UI_WAKE_COUNT,
+};
+
+/**
+ * @brief Signal that a source has work for the LVGL thread
+ *
+ * Any thread or ISR. Signals arriving before the display work queue has
+ * handled the previous ones are coalesced.
+ */
+void ui_wake(enum ui_wake_source source);
+
+/**
+ * @brief Bind the LVGL timer run on a source's signal
+ *
+ * LVGL thread only. With wakeups enabled the timer period is set to
+ * CONFIG_PROSPECTOR_UI_WAKE_FALLBACK_MS, otherwise to poll_ms. Binding
+ * readies the timer once, so a signal sent before it existed is not lost.
+ *
+ * @param timer Timer to bind, NULL before deleting the bound one
+ * @param poll_ms Period used when wakeups are disabled or the source is held
+ */
+void ui_wake_bind(enum ui_wake_source source, lv_timer_t *timer, uint32_t poll_ms);
+
+/**
+ * @brief Keep a bound timer at its polling period
+ *
+ * LVGL thread only. For consumers that need periodic runs between
+ * signals while an interaction lasts (press timing, scroll momentum).
+ * Releasing returns the timer to the fallback period.
+ */
+void ui_wake_hold(enum ui_wake_source source, bool hold);
+
+/**
+ * @brief Count a run of a bound timer callback
+ *
+ * @param idle true if the callback found nothing to do
+ */
+void ui_wake_count_run(enum ui_wake_source source, bool idle);
+
+/** Disable to measure the polling baseline (timers back to poll_ms) */
+void ui_wake_set_enabled(bool enabled);
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Binary status stream for host tools
+ *
+ * Frames are written directly into a TX ring buffer (no intermediate frame
+ * buffer) and drained in batches by a delayed work item, so a burst of
+ * advertisements becomes one UART/USB transfer instead of one per packet.
+ * The UART ISR hands ring memory straight to uart_fifo_fill() via
+ * ring_buf_get_claim(), so payload bytes are copied exactly once.
+ *
+ * Transport: the devicetree chosen node "zmk,prospector-stream" if present,
+ * otherwise the console cdc_acm_uart (disable logging in that case).
+ * Only CDC ACM has been exercised; other UARTs should work through the
+ * chosen node but are untested.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+#include "usb_stream.h"
+#include "scanner_stub.h"
+
+LOG_MODULE_REGISTER(usb_stream, LOG_LEVEL_INF);
+
+#if DT_HAS_CHOSEN(zmk_prospector_stream)
+#define STREAM_UART_NODE DT_CHOSEN(zmk_prospector_stream)
+#elif DT_NODE_EXISTS(DT_NODELABEL(cdc_acm_uart))
+#define STREAM_UART_NODE DT_NODELABEL(cdc_acm_uart)
+#else
+#error "No UART for Prospector stream (set chosen zmk,prospector-stream)"
+#endif
+
+#define STREAM_HEADER_SIZE 5
+#define STREAM_CRC_SIZE    2
+
+static const struct device *stream_dev = DEVICE_DT_GET(STREAM_UART_NODE);
+
+RING_BUF_DECLARE(stream_tx_ring, CONFIG_PROSPECTOR_USB_STREAM_BUFFER_SIZE);
+static struct k_spinlock stream_lock;
+static uint8_t stream_seq = 0;
+static uint32_t frames_dropped = 0;
+static bool stream_ready = false;
+
+static void stream_flush_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(stream_flush_work, stream_flush_work_handler);
+
+static void stream_stats_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(stream_stats_work, stream_stats_work_handler);
+
+/* Host must have the port open (DTR) before we start filling the ring */
+static bool stream_host_connected(void) {
+#if IS_ENABLED(CONFIG_UART_LINE_CTRL)
+    uint32_t dtr = 0;
+    if (uart_line_ctrl_get(stream_dev, UART_LINE_CTRL_DTR, &dtr) == 0) {
+        return dtr != 0;
+    }
+#endif
+    return true;
+}
+
+/* Write one complete frame into the ring, or nothing if it does not fit */
+static void stream_put_frame(uint8_t type, const void *payload, uint8_t len) {
+    if (!stream_ready || !stream_host_connected()) {
+        return;
+    }
+
+    uint32_t total = STREAM_HEADER_SIZE + len + STREAM_CRC_SIZE;
+    k_spinlock_key_t key = k_spin_lock(&stream_lock);
+
+    if (ring_buf_space_get(&stream_tx_ring) < total) {
+        frames_dropped++;
+        k_spin_unlock(&stream_lock, key);
+        return;
+    }
+
+    uint8_t header[STREAM_HEADER_SIZE] = {
+        USB_STREAM_SYNC0, USB_STREAM_SYNC1, type, stream_seq++, len,
+    };
+
+    uint16_t crc = crc16_ccitt(0xFFFF, &header[2], 3);
+    crc = crc16_ccitt(crc, payload, len);
+    uint8_t crc_le[STREAM_CRC_SIZE] = {crc & 0xFF, crc >> 8};
+
+    ring_buf_put(&stream_tx_ring, header, sizeof(header));
+    ring_buf_put(&stream_tx_ring, payload, len);
+    ring_buf_put(&stream_tx_ring, crc_le, sizeof(crc_le));
+
+    k_spin_unlock(&stream_lock, key);
+
+    /* Already-scheduled work is left alone - this is what batches frames */
+    k_work_schedule(&stream_flush_work, K_MSEC(CONFIG_PROSPECTOR_USB_STREAM_FLUSH_MS));
+}
+
+#if IS_ENABLED(CONFIG_UART_INTERRUPT_DRIVEN)
+
+static void stream_uart_isr(const struct device *dev, void *user_data) {
+    ARG_UNUSED(user_data);
+
+    while (uart_irq_update(dev) && uart_irq_is_pending(dev)) {
+        if (!uart_irq_tx_ready(dev)) {
+            continue;
+        }
+
+        uint8_t *data;
+        uint32_t avail = ring_buf_get_claim(&stream_tx_ring, &data,
+                                            CONFIG_PROSPECTOR_USB_STREAM_BUFFER_SIZE);
+        if (avail == 0) {
+            uart_irq_tx_disable(dev);
+            break;
+        }
+
+        int sent = uart_fifo_fill(dev, data, avail);
+        ring_buf_get_finish(&stream_tx_ring, MAX(sent, 0));
+    }
+}
+
+static void stream_flush_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+    uart_irq_tx_enable(stream_dev);
+}
+
+#else
+
+/* Polling fallback (e.g. pty uart without interrupt support) */
+static void stream_flush_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    uint8_t *data;
+    uint32_t avail;
+    while ((avail = ring_buf_get_claim(&stream_tx_ring, &data,
+                                       CONFIG_PROSPECTOR_USB_STREAM_BUFFER_SIZE)) > 0) {
+        for (uint32_t i = 0; i < avail; i++) {
+            uart_poll_out(stream_dev, data[i]);
+        }
+        ring_buf_get_finish(&stream_tx_ring, avail);
+    }
+}
+
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+static void stream_send_hello(void) {
+    struct usb_stream_hello hello = {
+        .protocol_version = USB_STREAM_PROTOCOL_VERSION,
+        .max_keyboards = SCANNER_STUB_MAX_KEYBOARDS,
+        .adv_data_size = sizeof(struct zmk_status_adv_data),
+    };
+    stream_put_frame(USB_STREAM_TYPE_HELLO, &hello, sizeof(hello));
+}
+
+static void stream_stats_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    /* Re-announce whenever a host (re)opens the port */
+    static bool host_was_connected = false;
+    bool host_connected = stream_host_connected();
+    if (host_connected && !host_was_connected) {
+        stream_send_hello();
+    }
+    host_was_connected = host_connected;
+
+    struct usb_stream_stats stats = {
+        .uptime_ms = k_uptime_get_32(),
+        .frames_dropped = frames_dropped,
+    };
+    scanner_msg_get_stats(&stats.msgs_sent, &stats.msgs_dropped, &stats.msgs_processed);
+    stream_put_frame(USB_STREAM_TYPE_STATS, &stats, sizeof(stats));
+
+    k_work_schedule(&stream_stats_work, K_SECONDS(1));
+}
+
+void usb_stream_send_keyboard(int slot, int8_t rssi, const uint8_t *ble_addr,
+                              uint8_t ble_addr_type,
+                              const struct zmk_status_adv_data *data) {
+    struct usb_stream_keyboard frame = {
+        .slot = (uint8_t)slot,
+        .rssi = rssi,
+        .ble_addr_type = ble_addr_type,
+        .timestamp_ms = k_uptime_get_32(),
+        .data = *data,
+    };
+    if (ble_addr) {
+        memcpy(frame.ble_addr, ble_addr, sizeof(frame.ble_addr));
+    }
+    stream_put_frame(USB_STREAM_TYPE_KEYBOARD, &frame, sizeof(frame));
+}
+
+void usb_stream_send_lost(int slot) {
+    struct usb_stream_lost frame = {
+        .slot = (uint8_t)slot,
+        .timestamp_ms = k_uptime_get_32(),
+    };
+    stream_put_frame(USB_STREAM_TYPE_LOST, &frame, sizeof(frame));
+}
+
+void usb_stream_send_telemetry(const uint8_t *buf, size_t len) {
+    if (len > UINT8_MAX) {
+        return;
+    }
+    stream_put_frame(USB_STREAM_TYPE_TELEMETRY, buf, (uint8_t)len);
+}
+
+bool usb_stream_is_ready(void) {
+    return stream_ready && stream_host_connected();
+}
+
+static int usb_stream_init(void) {
+    if (!device_is_ready(stream_dev)) {
+        LOG_ERR("Stream UART not ready");
+        return 0;
+    }
+
+#if IS_ENABLED(CONFIG_UART_INTERRUPT_DRIVEN)
+    uart_irq_callback_user_data_set(stream_dev, stream_uart_isr, NULL);
+#endif
+
+    stream_ready = true;
+    k_work_schedule(&stream_stats_work, K_SECONDS(1));
+
+    LOG_INF("Status stream ready on %s", stream_dev->name);
+    return 0;
+}
+
+SYS_INIT(usb_stream_init, APPLICATION, 97);
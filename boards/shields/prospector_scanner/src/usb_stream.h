@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Binary status stream for host tools (USB CDC ACM)
+ *
+ * Frame layout (all multi-byte fields little-endian):
+ *   [0xA5][0x5A][type][seq][len][payload: len bytes][crc16 lo][crc16 hi]
+ *
+ * CRC is CRC-16/CCITT (seed 0xFFFF) over type, seq, len and payload.
+ * seq increments per frame so the host can detect dropped frames.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <zmk/status_advertisement.h>
+
+#define USB_STREAM_SYNC0 0xA5
+#define USB_STREAM_SYNC1 0x5A
+
+#define USB_STREAM_PROTOCOL_VERSION 1
+
+/* Frame types */
+#define USB_STREAM_TYPE_HELLO    0x00  // Sent on every host connect (DTR rising edge)
+#define USB_STREAM_TYPE_KEYBOARD 0x01  // One received advertisement
+#define USB_STREAM_TYPE_LOST     0x02  // Keyboard slot timed out
+#define USB_STREAM_TYPE_STATS    0x03  // Reception statistics (1Hz)
+#define USB_STREAM_TYPE_TELEMETRY 0x04 // Raw telemetry batch (see telemetry_log.h)
+
+struct usb_stream_hello {
+    uint8_t protocol_version;
+    uint8_t max_keyboards;
+    uint8_t adv_data_size;
+} __packed;
+
+struct usb_stream_keyboard {
+    uint8_t slot;
+    int8_t rssi;
+    uint8_t ble_addr[6];
+    uint8_t ble_addr_type;
+    uint32_t timestamp_ms;
+    struct zmk_status_adv_data data;
+} __packed;
+
+struct usb_stream_lost {
+    uint8_t slot;
+    uint32_t timestamp_ms;
+} __packed;
+
+struct usb_stream_stats {
+    uint32_t uptime_ms;
+    uint32_t msgs_sent;
+    uint32_t msgs_dropped;
+    uint32_t msgs_processed;
+    uint32_t frames_dropped;  // Frames that did not fit into the TX ring
+} __packed;
+
+/**
+ * @brief Queue one keyboard advertisement for the host
+ *
+ * Safe to call from the BLE receive path: the frame is written straight
+ * into the TX ring and sent by the stream's own flush work.
+ */
+void usb_stream_send_keyboard(int slot, int8_t rssi, const uint8_t *ble_addr,
+                              uint8_t ble_addr_type,
+                              const struct zmk_status_adv_data *data);
+
+/**
+ * @brief Queue a keyboard-lost notification for the host
+ */
+void usb_stream_send_lost(int slot);
+
+/**
+ * @brief Queue one raw telemetry batch for the host
+ *
+ * @param buf Batch as stored in flash (max 255 bytes)
+ * @param len Batch length
+ */
+void usb_stream_send_telemetry(const uint8_t *buf, size_t len);
+
+/**
+ * @brief Check whether the stream transport is up
+ */
+bool usb_stream_is_ready(void);
@@ -53,6 +53,17 @@ struct st7789v_data {
 	uint16_t x_offset;
 	uint16_t y_offset;
 	enum display_orientation orientation;
+	struct st7789v_stats stats;
+	/* 9-bit words staged for 3-wire mode (no D/C GPIO) */
+	uint16_t tx9_words[CONFIG_PROSPECTOR_ST7789V_9BIT_CHUNK];
+	/* Pixel rows of one RAMWR, read by the SPI driver until it completes */
+	struct spi_buf tx_rows[CONFIG_PROSPECTOR_ST7789V_SG_ROWS];
+	struct spi_buf_set tx_bufs;
+#ifdef CONFIG_PROSPECTOR_ST7789V_ASYNC
+	struct k_sem tx_done;
+	bool tx_busy;
+	uint32_t tx_start_cyc;
+#endif
 };
 
 #ifdef CONFIG_ST7789V_RGB565
@@ -69,11 +80,112 @@ static void st7789v_set_lcd_margins(const struct device *dev, uint16_t x_offset,
 	data->y_offset = y_offset;
 }
 
+/*
+ * Asynchronous flush: pixel data is sent with spi_transceive_cb() and
+ * st7789v_write() returns while the transfer runs. LVGL reports the flush
+ * ready as soon as the write returns and renders into its other buffer;
+ * the buffer in flight is only reused after the next write, which starts
+ * by waiting here for the previous transfer. Every command waits as well,
+ * since the D/C line must not change under a running transfer.
+ */
+static void st7789v_wait_idle(const struct device *dev)
+{
+#ifdef CONFIG_PROSPECTOR_ST7789V_ASYNC
+	struct st7789v_data *data = dev->data;
+
+	if (!data->tx_busy) {
+		return;
+	}
+
+	uint32_t start = k_cycle_get_32();
+
+	k_sem_take(&data->tx_done, K_FOREVER);
+	data->tx_busy = false;
+	data->stats.wait_us += k_cyc_to_us_floor32(k_cycle_get_32() - start);
+#else
+	ARG_UNUSED(dev);
+#endif
+}
+
+#ifdef CONFIG_PROSPECTOR_ST7789V_ASYNC
+static void st7789v_tx_done(const struct device *spi_dev, int result, void *user_data)
+{
+	const struct device *dev = user_data;
+	struct st7789v_data *data = dev->data;
+
+	ARG_UNUSED(spi_dev);
+
+	if (result < 0) {
+		LOG_ERR("Async pixel transfer failed (%d)", result);
+	}
+	data->stats.busy_us += k_cyc_to_us_floor32(k_cycle_get_32() - data->tx_start_cyc);
+	k_sem_give(&data->tx_done);
+}
+
+/* Send the staged pixel rows without waiting for completion */
+static int st7789v_transmit_async(const struct device *dev)
+{
+	const struct st7789v_config *config = dev->config;
+	struct st7789v_data *data = dev->data;
+	int ret;
+
+	data->tx_start_cyc = k_cycle_get_32();
+	data->tx_busy = true;
+
+	ret = spi_transceive_cb(config->bus.bus, &config->bus.config, &data->tx_bufs, NULL,
+				st7789v_tx_done, (void *)dev);
+	if (ret < 0) {
+		data->tx_busy = false;
+		LOG_ERR("Failed to start async pixel transfer (%d)", ret);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_PROSPECTOR_ST7789V_ASYNC */
+
+/*
+ * 3-wire mode: every byte goes out as a 9-bit word with the D/C flag in
+ * bit 8 (0 for the command). Words are staged, command first, and sent
+ * CONFIG_PROSPECTOR_ST7789V_9BIT_CHUNK at a time rather than as one
+ * two-byte transaction per byte.
+ */
+static void st7789v_transmit_9bit(const struct device *dev, uint8_t cmd, const uint8_t *tx_data,
+				  size_t tx_count)
+{
+	const struct st7789v_config *config = dev->config;
+	struct st7789v_data *data = dev->data;
+	uint16_t *words = data->tx9_words;
+	struct spi_buf tx_buf = {.buf = words};
+	struct spi_buf_set tx_bufs = {.buffers = &tx_buf, .count = 1};
+	size_t count = 0;
+
+	if (cmd != ST7789V_CMD_NONE) {
+		words[count++] = cmd;
+	}
+
+	if (tx_data != NULL) {
+		for (size_t index = 0; index < tx_count; ++index) {
+			words[count++] = 0x0100 | tx_data[index];
+			if (count == ARRAY_SIZE(data->tx9_words)) {
+				tx_buf.len = count * sizeof(uint16_t);
+				spi_write_dt(&config->bus, &tx_bufs);
+				count = 0;
+			}
+		}
+	}
+
+	if (count > 0) {
+		tx_buf.len = count * sizeof(uint16_t);
+		spi_write_dt(&config->bus, &tx_bufs);
+	}
+}
+
 static void st7789v_transmit(const struct device *dev, uint8_t cmd, uint8_t *tx_data,
 			     size_t tx_count)
 {
 	const struct st7789v_config *config = dev->config;
-	uint16_t data = cmd;
+
+	st7789v_wait_idle(dev);
 
 	struct spi_buf tx_buf = {.buf = &cmd, .len = 1};
 	struct spi_buf_set tx_bufs = {.buffers = &tx_buf, .count = 1};
@@ -91,19 +203,7 @@ static void st7789v_transmit(const struct device *dev, uint8_t cmd, uint8_t *tx_
 			spi_write_dt(&config->bus, &tx_bufs);
 		}
 	} else {
-		tx_buf.buf = &data;
-		tx_buf.len = 2;
-
-		if (cmd != ST7789V_CMD_NONE) {
-			spi_write_dt(&config->bus, &tx_bufs);
-		}
-
-		if (tx_data != NULL) {
-			for (size_t index = 0; index < tx_count; ++index) {
-				data = 0x0100 | tx_data[index];
-				spi_write_dt(&config->bus, &tx_bufs);
-			}
-		}
+		st7789v_transmit_9bit(dev, cmd, tx_data, tx_count);
 	}
 }
 
@@ -160,12 +260,69 @@ static void st7789v_set_mem_area(const struct device *dev, const uint16_t x, con
 	st7789v_transmit(dev, ST7789V_CMD_RASET, (uint8_t *)&spi_data[0], 4);
 }
 
+/*
+ * Pixel data after RAMWR with a D/C GPIO. A strided buffer (pitch > width)
+ * is sent as one spi_buf per row, CONFIG_PROSPECTOR_ST7789V_SG_ROWS rows
+ * per transaction, without copying and without toggling D/C per row. The
+ * last transaction is asynchronous with CONFIG_PROSPECTOR_ST7789V_ASYNC.
+ */
+static int st7789v_write_rows(const struct device *dev,
+			      const struct display_buffer_descriptor *desc, const uint8_t *buf)
+{
+	const struct st7789v_config *config = dev->config;
+	struct st7789v_data *data = dev->data;
+	const size_t row_len = desc->width * ST7789V_PIXEL_SIZE;
+	const size_t pitch_len = desc->pitch * ST7789V_PIXEL_SIZE;
+	uint16_t rows = desc->height;
+	uint32_t start;
+	int ret = 0;
+
+	gpio_pin_set_dt(&config->cmd_data_gpio, 0);
+
+	while (rows > 0U) {
+		size_t count = 0;
+
+		if (desc->pitch == desc->width) {
+			data->tx_rows[count].buf = (void *)buf;
+			data->tx_rows[count++].len = row_len * rows;
+			rows = 0U;
+		} else {
+			while (rows > 0U && count < ARRAY_SIZE(data->tx_rows)) {
+				data->tx_rows[count].buf = (void *)buf;
+				data->tx_rows[count++].len = row_len;
+				buf += pitch_len;
+				rows--;
+			}
+		}
+		data->tx_bufs.buffers = data->tx_rows;
+		data->tx_bufs.count = count;
+
+#ifdef CONFIG_PROSPECTOR_ST7789V_ASYNC
+		if (rows == 0U) {
+			return st7789v_transmit_async(dev);
+		}
+#endif
+		start = k_cycle_get_32();
+		ret = spi_write_dt(&config->bus, &data->tx_bufs);
+		data->stats.busy_us += k_cyc_to_us_floor32(k_cycle_get_32() - start);
+		if (ret < 0) {
+			LOG_ERR("Pixel transfer failed (%d)", ret);
+			return ret;
+		}
+	}
+
+	return ret;
+}
+
 static int st7789v_write(const struct device *dev, const uint16_t x, const uint16_t y,
 			 const struct display_buffer_descriptor *desc, const void *buf)
 {
+	const struct st7789v_config *config = dev->config;
+	struct st7789v_data *data = dev->data;
 	const uint8_t *write_data_start = (uint8_t *)buf;
 	uint16_t nbr_of_writes;
 	uint16_t write_h;
+	uint32_t start;
 
 	__ASSERT(desc->width <= desc->pitch, "Pitch is smaller then width");
 	__ASSERT((desc->pitch * ST7789V_PIXEL_SIZE * desc->height) <= desc->buf_size,
@@ -174,6 +331,17 @@ static int st7789v_write(const struct device *dev, const uint16_t x, const uint1
 	LOG_DBG("Writing %dx%d (w,h) @ %dx%d (x,y)", desc->width, desc->height, x, y);
 	st7789v_set_mem_area(dev, x, y, desc->width, desc->height);
 
+	data->stats.writes++;
+	data->stats.bytes += desc->width * ST7789V_PIXEL_SIZE * desc->height;
+
+	if (config->cmd_data_gpio.port != NULL) {
+		st7789v_transmit(dev, ST7789V_CMD_RAMWR, NULL, 0);
+		return st7789v_write_rows(dev, desc, write_data_start);
+	}
+
+	/* 3-wire mode: rows continue the RAMWR through the 9-bit staging buffer */
+	start = k_cycle_get_32();
+
 	if (desc->pitch > desc->width) {
 		write_h = 1U;
 		nbr_of_writes = desc->height;
@@ -188,10 +356,31 @@ static int st7789v_write(const struct device *dev, const uint16_t x, const uint1
 				 desc->width * ST7789V_PIXEL_SIZE * write_h);
 		write_data_start += (desc->pitch * ST7789V_PIXEL_SIZE);
 	}
+	data->stats.busy_us += k_cyc_to_us_floor32(k_cycle_get_32() - start);
 
 	return 0;
 }
 
+int st7789v_set_idle_mode(const struct device *dev, bool idle)
+{
+	st7789v_transmit(dev, idle ? ST7789V_CMD_IDMON : ST7789V_CMD_IDMOFF, NULL, 0);
+	return 0;
+}
+
+void st7789v_get_stats(const struct device *dev, struct st7789v_stats *stats)
+{
+	const struct st7789v_data *data = dev->data;
+
+	*stats = data->stats;
+}
+
+void st7789v_reset_stats(const struct device *dev)
+{
+	struct st7789v_data *data = dev->data;
+
+	memset(&data->stats, 0, sizeof(data->stats));
+}
+
 static void st7789v_get_capabilities(const struct device *dev,
 				     struct display_capabilities *capabilities)
 {
@@ -365,6 +554,12 @@ static int st7789v_init(const struct device *dev)
 {
 	const struct st7789v_config *config = dev->config;
 
+#ifdef CONFIG_PROSPECTOR_ST7789V_ASYNC
+	struct st7789v_data *data = dev->data;
+
+	k_sem_init(&data->tx_done, 0, 1);
+#endif
+
 	if (!spi_is_ready_dt(&config->bus)) {
 		LOG_ERR("SPI device not ready");
 		return -ENODEV;
@@ -435,14 +630,46 @@ static const struct display_driver_api st7789v_api = {
 	.set_orientation = st7789v_set_orientation,
 };
 
-#define ST7789V_WORD_SIZE(inst) COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, cmd_data_gpios), (8), (9))
+/*
+ * The panel either sits directly on a SPI bus (cmd-data-gpios, reset-gpios)
+ * or, as with Zephyr 4.x bindings, on a zephyr,mipi-dbi-spi node, in which
+ * case the SPI device, chip select, D/C and reset come from that node.
+ */
+#define ST7789V_ON_DBI(inst) DT_NODE_HAS_COMPAT(DT_INST_PARENT(inst), zephyr_mipi_dbi_spi)
+#define ST7789V_DBI_SPI(inst) DT_PHANDLE(DT_INST_PARENT(inst), spi_dev)
+
+#define ST7789V_HAS_DC(inst)                                                                       \
+	COND_CODE_1(ST7789V_ON_DBI(inst), (DT_NODE_HAS_PROP(DT_INST_PARENT(inst), dc_gpios)),      \
+		    (DT_INST_NODE_HAS_PROP(inst, cmd_data_gpios)))
+
+#define ST7789V_OPERATION(inst) (SPI_OP_MODE_MASTER | SPI_WORD_SET(ST7789V_HAS_DC(inst) ? 8 : 9))
+
+#define ST7789V_DBI_SPI_SPEC(inst)                                                                 \
+	{                                                                                          \
+		.bus = DEVICE_DT_GET(ST7789V_DBI_SPI(inst)),                                       \
+		.config = {                                                                        \
+			.frequency = DT_INST_PROP(inst, mipi_max_frequency),                       \
+			.operation = ST7789V_OPERATION(inst),                                      \
+			.slave = DT_INST_REG_ADDR(inst),                                           \
+			.cs = {                                                                    \
+				.gpio = GPIO_DT_SPEC_GET_BY_IDX_OR(ST7789V_DBI_SPI(inst),          \
+								   cs_gpios,                       \
+								   DT_INST_REG_ADDR(inst), {}),    \
+				.delay = 0,                                                        \
+			},                                                                         \
+		},                                                                                 \
+	}
 
 #define ST7789V_INIT(inst)                                                                         \
 	static const struct st7789v_config st7789v_config_##inst = {                               \
-		.bus = SPI_DT_SPEC_INST_GET(                                                       \
-			inst, SPI_OP_MODE_MASTER | SPI_WORD_SET(ST7789V_WORD_SIZE(inst)), 0),      \
-		.cmd_data_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, cmd_data_gpios, {}),               \
-		.reset_gpio = GPIO_DT_SPEC_INST_GET_OR(inst, reset_gpios, {}),                     \
+		.bus = COND_CODE_1(ST7789V_ON_DBI(inst), (ST7789V_DBI_SPI_SPEC(inst)),             \
+				   (SPI_DT_SPEC_INST_GET(inst, ST7789V_OPERATION(inst), 0))),      \
+		.cmd_data_gpio = COND_CODE_1(ST7789V_ON_DBI(inst),                                 \
+				(GPIO_DT_SPEC_GET_OR(DT_INST_PARENT(inst), dc_gpios, {})),         \
+				(GPIO_DT_SPEC_INST_GET_OR(inst, cmd_data_gpios, {}))),             \
+		.reset_gpio = COND_CODE_1(ST7789V_ON_DBI(inst),                                    \
+				(GPIO_DT_SPEC_GET_OR(DT_INST_PARENT(inst), reset_gpios, {})),      \
+				(GPIO_DT_SPEC_INST_GET_OR(inst, reset_gpios, {}))),                \
 		.vcom = DT_INST_PROP(inst, vcom),                                                  \
 		.gctrl = DT_INST_PROP(inst, gctrl),                                                \
 		.vdv_vrh_enable =                                                                  \
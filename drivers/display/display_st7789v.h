@@ -7,6 +7,7 @@
 #define ST7789V_DISPLAY_DRIVER_H__
 
 #include <zephyr/kernel.h>
+#include <zephyr/device.h>
 
 #define ST7789V_CMD_NOP				0x00
 #define ST7789V_CMD_SW_RESET			0x01
@@ -36,6 +37,9 @@
 #define ST7789V_MADCTL_MH_LEFT_TO_RIGHT		0x00
 #define ST7789V_MADCTL_MH_RIGHT_TO_LEFT		0x04
 
+#define ST7789V_CMD_IDMOFF			0x38
+#define ST7789V_CMD_IDMON			0x39
+
 #define ST7789V_CMD_COLMOD			0x3a
 #define ST7789V_COLMOD_RGB_65K			(0x5 << 4)
 #define ST7789V_COLMOD_RGB_262K			(0x6 << 4)
@@ -70,4 +74,18 @@
 
 #define ST7789V_CMD_NONE			0xff
 
+/* Pixel data flush statistics */
+struct st7789v_stats {
+	uint32_t writes;	/* display_write() calls */
+	uint64_t bytes;		/* Pixel data bytes sent */
+	uint64_t busy_us;	/* SPI busy sending pixel data */
+	uint64_t wait_us;	/* Callers blocked on the transfer in flight */
+};
+
+void st7789v_get_stats(const struct device *dev, struct st7789v_stats *stats);
+void st7789v_reset_stats(const struct device *dev);
+
+/* Idle mode: 8 colors (MSB of each channel), lower panel power */
+int st7789v_set_idle_mode(const struct device *dev, bool idle);
+
 #endif
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -78,6 +79,64 @@ struct zmk_status_adv_data {
  */
 #define ZMK_STATUS_ADV_SERVICE_UUID 0xABCD
 
+/**
+ * @brief Number of buckets in the advertisement update timing histogram
+ */
+#define ZMK_STATUS_ADV_HIST_BUCKETS 6
+
+/**
+ * @brief Advertisement diagnostics counters (for shell/debug use)
+ */
+struct zmk_status_adv_stats {
+    uint32_t updates;          // Successful advertisement data updates
+    uint32_t busy_retries;     // -EAGAIN/-EBUSY retries
+    uint32_t errors;           // Persistent update errors
+    uint32_t set_resets;       // Advertising set delete/recreate cycles
+    uint32_t bursts;           // Bursts started (layer changes)
+    uint32_t burst_packets;    // Advertisements sent as part of a burst
+    int error_count;           // Current consecutive error count
+    uint32_t interval_ms;      // Current update interval
+    bool active;               // Activity mode (ACTIVE/IDLE)
+    bool adv_set_valid;        // Extended advertising set exists
+    uint32_t update_time_hist[ZMK_STATUS_ADV_HIST_BUCKETS]; // set_data duration, see below
+};
+
+/**
+ * @brief Upper bounds (microseconds) of the update timing histogram buckets.
+ * The last bucket is open-ended.
+ */
+#define ZMK_STATUS_ADV_HIST_BOUNDS_US {100, 250, 500, 1000, 2500}
+
+/**
+ * @brief Map a value to its histogram bucket
+ *
+ * Shared by the advertiser and scanner diagnostics histograms.
+ *
+ * @param bounds Ascending upper bounds (exclusive) of all but the last bucket
+ * @param count Number of bounds; the last, open-ended bucket is index count
+ */
+static inline int zmk_status_hist_bucket(const uint32_t *bounds, size_t count, uint32_t value) {
+    size_t bucket = 0;
+    while (bucket < count && value >= bounds[bucket]) {
+        bucket++;
+    }
+    return (int)bucket;
+}
+
+/**
+ * @brief Get advertisement diagnostics counters
+ *
+ * @param stats Output structure
+ */
+void zmk_status_advertisement_get_stats(struct zmk_status_adv_stats *stats);
+
+/**
+ * @brief Get the currently advertised payload
+ *
+ * @param data Output structure
+ */
+void zmk_status_advertisement_get_data(struct zmk_status_adv_data *data);
+
 /**
  * @brief Initialize status advertisement
  * 
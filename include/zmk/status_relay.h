@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zmk/status_advertisement.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Relay advertisement data structure
+ *
+ * Re-advertised by a scanner in relay mode: one keyboard per packet, rotated
+ * every advertising interval. Marker FF FF AB CE keeps it distinct from
+ * keyboard packets (AB CD), so scanners without relay support ignore it.
+ */
+struct zmk_status_relay_data {
+    uint8_t manufacturer_id[2];    // 0xFF, 0xFF (Company ID: 0xFFFF = Reserved)
+    uint8_t service_uuid[2];       // 0xAB, 0xCE (Prospector relay)
+    uint8_t version;               // Relay format version
+    uint8_t relay_id[2];           // Random per relay, used to drop own echoes
+    uint8_t hop_count;             // 1 = relay heard the keyboard directly
+    uint8_t age_ds;                // Age of the keyboard data, 100ms units (saturates)
+    uint8_t keyboard_id[4];        // Fields below copied from zmk_status_adv_data
+    uint8_t battery_level;
+    uint8_t peripheral_battery[3];
+    uint8_t active_layer;
+    uint8_t profile_slot;
+    uint8_t status_flags;
+    uint8_t modifier_flags;
+    uint8_t wpm_value;
+    uint8_t channel;
+    uint8_t device_role;
+    uint8_t reserved[2];           // Same length as zmk_status_adv_data
+} __packed;  // Total: 26 bytes
+
+#define ZMK_STATUS_RELAY_UUID_1  0xCE
+#define ZMK_STATUS_RELAY_VERSION 1
+
+/**
+ * @brief Relay statistics
+ */
+struct zmk_status_relay_stats {
+    bool advertising;              // Relay advertising set running
+    uint32_t interval_ms;          // Advertising interval from the airtime budget
+    uint32_t tx_updates;           // Relay packets set (one keyboard each)
+    uint32_t rx_packets;           // Relay packets received from other scanners
+    uint32_t rx_own;               // Own packets heard back (dropped)
+    uint32_t rx_too_old;           // Dropped: too many hops or too old
+};
+
+/**
+ * @brief Handle a relay packet found by the scanner (channel filter applied)
+ */
+void zmk_status_relay_handle_rx(const struct zmk_status_relay_data *relay, int8_t rssi);
+
+/**
+ * @brief Get relay statistics
+ */
+void zmk_status_relay_get_stats(struct zmk_status_relay_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
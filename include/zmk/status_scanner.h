@@ -106,6 +106,45 @@ int zmk_status_scanner_get_active_count(void);
  */
 int zmk_status_scanner_get_primary_keyboard(void);
 
+/**
+ * @brief Scanner radio diagnostics counters
+ */
+struct zmk_status_scanner_radio_stats {
+    bool scanning;               // Scanning is currently enabled
+    uint32_t scan_callbacks;     // All advertising reports received
+    uint32_t prospector_packets; // Reports carrying Prospector status data
+    uint32_t channel_filtered;   // Prospector reports dropped by channel filter
+    uint32_t last_rx_time;       // Uptime (ms) of last Prospector report, 0 if none
+    uint8_t channel;             // Current scanner channel (0 = all)
+};
+
+/**
+ * @brief Get scanner radio diagnostics counters
+ *
+ * @param stats Output structure
+ */
+void zmk_status_scanner_get_radio_stats(struct zmk_status_scanner_radio_stats *stats);
+
+/**
+ * @brief Scan-stall watchdog counters (CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+ */
+struct zmk_status_scanner_watchdog_stats {
+    bool stalled;                // No reports since the last detected stall
+    uint32_t stalls;             // Stalls detected
+    uint32_t restarts;           // Scan restarts (including backoff retries)
+    uint32_t restart_errors;     // bt_le_scan_start() failures during restart
+    uint32_t recoveries;         // Stalls that ended with reports flowing again
+    uint32_t last_recovery_ms;   // Detection -> first report, last stall
+    uint32_t max_recovery_ms;    // Detection -> first report, worst stall
+};
+
+/**
+ * @brief Get scan-stall watchdog counters
+ *
+ * @param stats Output structure
+ */
+void zmk_status_scanner_get_watchdog_stats(struct zmk_status_scanner_watchdog_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Live diagnostics shell: prospector stats|keyboards|latency|radio|heap
+ *
+ * Works on both sides: scanner builds report reception and display pipeline
+ * counters, keyboard builds report advertisement counters. Everything here
+ * only reads counters - no LVGL calls, safe from the shell thread.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <zmk/status_advertisement.h>
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_MODE_SCANNER)
+#include <zmk/status_scanner.h>
+// Include path assumes build from zmk-config-prospector
+#include "../boards/shields/prospector_scanner/src/scanner_stub.h"
+#endif
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+#include <lvgl_mem.h>
+#endif
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_MODE_SCANNER)
+
+static const char *const hist_labels[SCANNER_HIST_BUCKETS] = {
+    "<20ms", "<50ms", "<100ms", "<250ms", "<500ms", "<1s", ">=1s",
+};
+
+static void print_hist(const struct shell *sh, const char *title, const uint32_t *hist) {
+    shell_print(sh, "%s", title);
+    for (int i = 0; i < SCANNER_HIST_BUCKETS; i++) {
+        shell_print(sh, "  %-7s %u", hist_labels[i], hist[i]);
+    }
+}
+
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_STATUS_ADVERTISEMENT)
+
+static const char *const adv_hist_labels[ZMK_STATUS_ADV_HIST_BUCKETS] = {
+    "<100us", "<250us", "<500us", "<1ms", "<2.5ms", ">=2.5ms",
+};
+
+#endif
+
+static int cmd_stats(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_MODE_SCANNER)
+    uint32_t sent, dropped, processed;
+    struct scanner_display_stats ds;
+
+    scanner_msg_get_stats(&sent, &dropped, &processed);
+    scanner_get_display_stats(&ds);
+
+    shell_print(sh, "Scanner messages: sent=%u dropped=%u processed=%u queued=%u",
+                sent, dropped, processed, scanner_msg_get_queue_count());
+    shell_print(sh, "Display updates:  scheduled=%u coalesced=%u runs=%u skipped=%u",
+                ds.scheduled, ds.coalesced, ds.runs, ds.skipped);
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_STATUS_ADVERTISEMENT)
+    struct zmk_status_adv_stats as;
+
+    zmk_status_advertisement_get_stats(&as);
+    shell_print(sh, "Advertising: updates=%u busy=%u errors=%u resets=%u (consecutive=%d)",
+                as.updates, as.busy_retries, as.errors, as.set_resets, as.error_count);
+    shell_print(sh, "Bursts: started=%u packets=%u", as.bursts, as.burst_packets);
+#endif
+
+    return 0;
+}
+
+static int cmd_keyboards(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_MODE_SCANNER)
+    uint32_t now = k_uptime_get_32();
+    int selected = scanner_get_selected_keyboard();
+
+    shell_print(sh, "Slot Name             Address           RSSI Layer Bat          WPM      RX   Age(ms)");
+    for (int i = 0; i < SCANNER_STUB_MAX_KEYBOARDS; i++) {
+        struct zmk_status_adv_data data;
+        struct scanner_keyboard_stats kb;
+        int8_t rssi;
+        char name[32];
+
+        if (!scanner_get_keyboard_data(i, &data, &rssi, name, sizeof(name)) ||
+            !scanner_get_keyboard_stats(i, &kb)) {
+            shell_print(sh, "%c%-3d (empty)", i == selected ? '*' : ' ', i);
+            continue;
+        }
+
+        shell_print(sh, "%c%-3d %-16.16s %02X:%02X:%02X:%02X:%02X:%02X %4d %5u %3u/%3u/%3u/%3u %3u %7u %9u",
+                    i == selected ? '*' : ' ', i, name,
+                    kb.ble_addr[5], kb.ble_addr[4], kb.ble_addr[3],
+                    kb.ble_addr[2], kb.ble_addr[1], kb.ble_addr[0],
+                    rssi, data.active_layer, data.battery_level,
+                    data.peripheral_battery[0], data.peripheral_battery[1],
+                    data.peripheral_battery[2], data.wpm_value, kb.rx_count,
+                    now - kb.last_seen);
+    }
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_STATUS_ADVERTISEMENT)
+    struct zmk_status_adv_data adv;
+
+    zmk_status_advertisement_get_data(&adv);
+    shell_print(sh, "Advertised: layer=%u battery=%u%% periph=%u/%u/%u profile=%u wpm=%u "
+                "mods=0x%02X flags=0x%02X ch=%u",
+                adv.active_layer, adv.battery_level, adv.peripheral_battery[0],
+                adv.peripheral_battery[1], adv.peripheral_battery[2], adv.profile_slot,
+                adv.wpm_value, adv.modifier_flags, adv.status_flags, adv.channel);
+#endif
+
+    return 0;
+}
+
+static int cmd_latency(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_MODE_SCANNER)
+    struct scanner_display_stats ds;
+
+    scanner_get_display_stats(&ds);
+    print_hist(sh, "RX -> display work latency:", ds.latency_hist);
+
+    for (int i = 0; i < SCANNER_STUB_MAX_KEYBOARDS; i++) {
+        struct scanner_keyboard_stats kb;
+        char title[40];
+
+        if (!scanner_get_keyboard_stats(i, &kb)) {
+            continue;
+        }
+        snprintf(title, sizeof(title), "Slot %d advertisement interval:", i);
+        print_hist(sh, title, kb.interval_hist);
+    }
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_STATUS_ADVERTISEMENT)
+    struct zmk_status_adv_stats as;
+
+    zmk_status_advertisement_get_stats(&as);
+    shell_print(sh, "Advertising data update time:");
+    for (int i = 0; i < ZMK_STATUS_ADV_HIST_BUCKETS; i++) {
+        shell_print(sh, "  %-8s %u", adv_hist_labels[i], as.update_time_hist[i]);
+    }
+#endif
+
+    return 0;
+}
+
+static int cmd_radio(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_MODE_SCANNER)
+    struct zmk_status_scanner_radio_stats rs;
+
+    zmk_status_scanner_get_radio_stats(&rs);
+    shell_print(sh, "Scanning: %s, channel=%u%s", rs.scanning ? "yes" : "no",
+                rs.channel, rs.channel == 0 ? " (all)" : "");
+    shell_print(sh, "Reports: total=%u prospector=%u channel_filtered=%u",
+                rs.scan_callbacks, rs.prospector_packets, rs.channel_filtered);
+    if (rs.last_rx_time != 0) {
+        shell_print(sh, "Last Prospector RX: %u ms ago", k_uptime_get_32() - rs.last_rx_time);
+    }
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+    struct zmk_status_scanner_watchdog_stats ws;
+
+    zmk_status_scanner_get_watchdog_stats(&ws);
+    shell_print(sh, "Watchdog: %s, stalls=%u restarts=%u (failed=%u) recovered=%u",
+                ws.stalled ? "STALLED" : "ok", ws.stalls, ws.restarts, ws.restart_errors,
+                ws.recoveries);
+    if (ws.recoveries > 0) {
+        shell_print(sh, "Recovery time: last=%u ms max=%u ms",
+                    ws.last_recovery_ms, ws.max_recovery_ms);
+    }
+#endif
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_STATUS_ADVERTISEMENT)
+    struct zmk_status_adv_stats as;
+
+    zmk_status_advertisement_get_stats(&as);
+    shell_print(sh, "Advertising set: %s, mode=%s, interval=%u ms",
+                as.adv_set_valid ? "valid" : "none", as.active ? "ACTIVE" : "IDLE",
+                as.interval_ms);
+#endif
+
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+static int cmd_follow(const struct shell *sh, size_t argc, char **argv) {
+    if (argc > 1) {
+        if (strcmp(argv[1], "on") == 0) {
+            scanner_set_auto_follow(true);
+        } else if (strcmp(argv[1], "off") == 0) {
+            scanner_set_auto_follow(false);
+        } else {
+            shell_error(sh, "Usage: prospector follow [on|off]");
+            return -EINVAL;
+        }
+    }
+
+    shell_print(sh, "Auto-follow: %s, switches=%u, shown slot=%d",
+                scanner_get_auto_follow() ? "on" : "off",
+                scanner_get_auto_follow_switches(), scanner_get_selected_keyboard());
+    return 0;
+}
+#endif
+
+#if IS_ENABLED(CONFIG_THREAD_STACK_INFO)
+static void print_thread_stack(const struct k_thread *thread, void *user_data) {
+    const struct shell *sh = user_data;
+    size_t unused = 0;
+    const char *name = k_thread_name_get((k_tid_t)thread);
+
+    if (k_thread_stack_space_get(thread, &unused) != 0) {
+        return;
+    }
+    shell_print(sh, "  %-24s size=%5u unused=%5u", name ? name : "?",
+                thread->stack_info.size, unused);
+}
+#endif
+
+static int cmd_heap(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+#if IS_ENABLED(CONFIG_LV_Z_MEM_POOL_SYS_HEAP) && IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)
+    struct sys_memory_stats lv_stats;
+
+    lvgl_heap_stats(&lv_stats);
+    shell_print(sh, "LVGL pool: used=%u free=%u max_used=%u",
+                lv_stats.allocated_bytes, lv_stats.free_bytes, lv_stats.max_allocated_bytes);
+#endif
+
+#if IS_ENABLED(CONFIG_THREAD_STACK_INFO)
+    shell_print(sh, "Thread stacks:");
+    k_thread_foreach_unlocked(print_thread_stack, (void *)sh);
+#else
+    shell_print(sh, "Enable CONFIG_THREAD_STACK_INFO for stack usage");
+#endif
+
+    return 0;
+}
+
+/* Section-based set so other modules can add subcommands with
+ * SHELL_SUBCMD_ADD((prospector), ...) */
+SHELL_SUBCMD_SET_CREATE(prospector_cmds, (prospector));
+
+SHELL_SUBCMD_ADD((prospector), stats, NULL, "Message, display and advertising counters",
+                 cmd_stats, 1, 0);
+SHELL_SUBCMD_ADD((prospector), keyboards, NULL, "Per-keyboard status table", cmd_keyboards, 1, 0);
+SHELL_SUBCMD_ADD((prospector), latency, NULL, "Timing histograms", cmd_latency, 1, 0);
+SHELL_SUBCMD_ADD((prospector), radio, NULL, "Scanner / advertiser radio state", cmd_radio, 1, 0);
+SHELL_SUBCMD_ADD((prospector), heap, NULL, "LVGL pool and thread stack usage", cmd_heap, 1, 0);
+#if IS_ENABLED(CONFIG_PROSPECTOR_AUTO_FOLLOW)
+SHELL_SUBCMD_ADD((prospector), follow, NULL, "Auto-follow state [on|off]", cmd_follow, 1, 1);
+#endif
+
+SHELL_CMD_REGISTER(prospector, &prospector_cmds, "Prospector diagnostics", NULL);
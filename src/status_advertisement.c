@@ -100,6 +100,17 @@ static bool adv_needs_restart = false;  // Flag to indicate advertising needs re
 static int adv_error_count = 0;  // Error counter for retry logic
 #define ADV_MAX_ERRORS_BEFORE_RESET 3
 
+// Diagnostics counters (read via zmk_status_advertisement_get_stats)
+static struct zmk_status_adv_stats adv_stats;
+static const uint32_t adv_hist_bounds_us[] = ZMK_STATUS_ADV_HIST_BOUNDS_US;
+BUILD_ASSERT(ARRAY_SIZE(adv_hist_bounds_us) == ZMK_STATUS_ADV_HIST_BUCKETS - 1);
+static uint32_t adv_last_interval_ms = 0;
+
+static void adv_stats_record_update_time(uint32_t us) {
+    adv_stats.update_time_hist[zmk_status_hist_bucket(adv_hist_bounds_us,
+                                                      ARRAY_SIZE(adv_hist_bounds_us), us)]++;
+}
+
 // Adaptive update intervals based on activity - using Kconfig values for flexibility
 #if IS_ENABLED(CONFIG_ZMK_STATUS_ADV_ACTIVITY_BASED)
 #define ACTIVE_UPDATE_INTERVAL_MS   CONFIG_ZMK_STATUS_ADV_ACTIVE_INTERVAL_MS    // Configurable active interval
@@ -210,6 +221,7 @@ static int layer_changed_listener(const zmk_event_t *eh) {
                 BURST_COUNT, BURST_INTERVAL_MS);
         if (adv_started) {
             atomic_set(&burst_remaining, BURST_COUNT);
+            adv_stats.bursts++;
             k_work_cancel_delayable(&adv_work);
             k_work_schedule(&adv_work, K_NO_WAIT);
         }
@@ -810,20 +822,25 @@ static void adv_work_handler(struct k_work *work) {
     build_manufacturer_payload();
 
     // Update existing advertising data using Extended Advertising API
+    uint32_t start_cycles = k_cycle_get_32();
     int err = bt_le_ext_adv_set_data(adv_set, adv_data_array, ARRAY_SIZE(adv_data_array),
                                      scan_rsp, ARRAY_SIZE(scan_rsp));
+    adv_stats_record_update_time(k_cyc_to_us_floor32(k_cycle_get_32() - start_cycles));
 
     if (err == 0) {
         LOG_DBG("✅ Extended advertising data updated successfully");
         adv_error_count = 0;  // Reset error count on success
+        adv_stats.updates++;
     } else if (err == -EAGAIN || err == -EBUSY) {
         // Temporary error - just retry later without resetting
         LOG_WRN("⚠️ Advertising update busy (%d), retrying...", err);
+        adv_stats.busy_retries++;
         k_work_schedule(&adv_work, K_MSEC(100));
         return;
     } else {
         // Persistent error - count and potentially reset
         adv_error_count++;
+        adv_stats.errors++;
         LOG_ERR("❌ Extended advertising update failed: %d (error %d/%d)",
                 err, adv_error_count, ADV_MAX_ERRORS_BEFORE_RESET);
 
@@ -835,6 +852,7 @@ static void adv_work_handler(struct k_work *work) {
                 adv_set = NULL;
             }
             adv_error_count = 0;
+            adv_stats.set_resets++;
             // Schedule restart with delay
             k_work_schedule(&adv_work, K_MSEC(500));
             return;
@@ -845,6 +863,7 @@ static void adv_work_handler(struct k_work *work) {
     int remaining = atomic_get(&burst_remaining);
     if (remaining > 0) {
         atomic_dec(&burst_remaining);
+        adv_stats.burst_packets++;
         LOG_DBG("⚡ Burst advertisement %d/%d", BURST_COUNT - remaining + 1, BURST_COUNT);
         k_work_schedule(&adv_work, K_MSEC(BURST_INTERVAL_MS));
         return;  // Skip normal interval scheduling during burst
@@ -852,6 +871,7 @@ static void adv_work_handler(struct k_work *work) {
 
     // Schedule next update with adaptive interval
     uint32_t interval_ms = get_current_update_interval();
+    adv_last_interval_ms = interval_ms;
 
     // Periodic logging of current interval (every 20th update to avoid spam)
     static int update_counter = 0;
@@ -941,6 +961,18 @@ int zmk_status_advertisement_stop(void) {
     return 0;
 }
 
+void zmk_status_advertisement_get_stats(struct zmk_status_adv_stats *stats) {
+    *stats = adv_stats;
+    stats->error_count = adv_error_count;
+    stats->interval_ms = adv_last_interval_ms;
+    stats->active = is_active;
+    stats->adv_set_valid = (adv_set != NULL);
+}
+
+void zmk_status_advertisement_get_data(struct zmk_status_adv_data *data) {
+    *data = manufacturer_data;
+}
+
 // Note: Profile changes are detected through periodic updates (200ms/1000ms intervals)
 // This provides sufficient responsiveness without needing complex event listeners
 
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Scanner relay mode: re-advertise the keyboards this scanner holds so
+ * scanners out of a keyboard's range can still show it.
+ *
+ * - TX: one non-connectable legacy advertising set. Every advertising
+ *   interval the payload is switched to the next relayable keyboard
+ *   (round robin). The interval is derived from the airtime budget, so
+ *   the relay never uses more than CONFIG_PROSPECTOR_RELAY_AIRTIME_PERMILLE
+ *   of the channel no matter how many keyboards it carries.
+ * - RX: relay packets found by status_scanner.c are merged through
+ *   scanner_stub with lower priority than direct receptions.
+ *
+ * Loops are bounded by the hop limit and the maximum age: an entry is only
+ * re-advertised while hop_count < MAX_HOPS and its data is fresh enough.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include <zmk/status_advertisement.h>
+#include <zmk/status_relay.h>
+
+// Include path assumes build from zmk-config-prospector
+#include "../boards/shields/prospector_scanner/src/scanner_stub.h"
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+LOG_MODULE_REGISTER(status_relay, LOG_LEVEL_INF);
+
+// Air time of one legacy advertising event on all 3 channels at 1M PHY:
+// preamble(1) + access address(4) + header(2) + AdvA(6) + AD + CRC(3)
+#define RELAY_AD_LEN           (2 + sizeof(struct zmk_status_relay_data))
+#define RELAY_EVENT_AIRTIME_US (3 * 8 * (1 + 4 + 2 + 6 + RELAY_AD_LEN + 3))
+#define RELAY_MIN_INTERVAL_MS  100
+
+#define RELAY_INTERVAL_MS \
+    ((uint32_t)MAX(RELAY_MIN_INTERVAL_MS, \
+                   RELAY_EVENT_AIRTIME_US / CONFIG_PROSPECTOR_RELAY_AIRTIME_PERMILLE))
+
+static struct bt_le_ext_adv *relay_adv = NULL;
+static bool relay_advertising = false;
+static uint16_t relay_id = 0;
+static int relay_next_slot = 0;
+static struct zmk_status_relay_stats relay_stats;
+
+static struct zmk_status_relay_data relay_payload = {
+    .manufacturer_id = {0xFF, 0xFF},
+    .service_uuid = {0xAB, ZMK_STATUS_RELAY_UUID_1},
+    .version = ZMK_STATUS_RELAY_VERSION,
+};
+
+static const struct bt_data relay_ad[] = {
+    BT_DATA(BT_DATA_MANUFACTURER_DATA, &relay_payload, sizeof(relay_payload)),
+};
+
+static void relay_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(relay_work, relay_work_handler);
+
+void zmk_status_relay_handle_rx(const struct zmk_status_relay_data *relay, int8_t rssi) {
+    relay_stats.rx_packets++;
+
+    if (relay->version != ZMK_STATUS_RELAY_VERSION) {
+        return;
+    }
+    if (sys_get_be16(relay->relay_id) == relay_id) {
+        relay_stats.rx_own++;
+        return;
+    }
+
+    uint32_t age_ms = relay->age_ds * 100U;
+    if (relay->hop_count == 0 || relay->hop_count > CONFIG_PROSPECTOR_RELAY_MAX_HOPS ||
+        age_ms > CONFIG_PROSPECTOR_RELAY_MAX_AGE_MS) {
+        relay_stats.rx_too_old++;
+        return;
+    }
+
+    struct zmk_status_adv_data data = {
+        .manufacturer_id = {0xFF, 0xFF},
+        .service_uuid = {0xAB, 0xCD},
+        .version = 1,
+        .battery_level = relay->battery_level,
+        .active_layer = relay->active_layer,
+        .profile_slot = relay->profile_slot,
+        .status_flags = relay->status_flags,
+        .device_role = relay->device_role,
+        .modifier_flags = relay->modifier_flags,
+        .wpm_value = relay->wpm_value,
+        .channel = relay->channel,
+    };
+    memcpy(data.keyboard_id, relay->keyboard_id, sizeof(data.keyboard_id));
+    memcpy(data.peripheral_battery, relay->peripheral_battery, sizeof(data.peripheral_battery));
+
+    scanner_msg_send_relayed_keyboard_data(&data, rssi, relay->hop_count, age_ms);
+}
+
+/* Fill relay_payload with the next relayable slot, round robin */
+static bool relay_pick_next(void) {
+    for (int n = 0; n < SCANNER_STUB_MAX_KEYBOARDS; n++) {
+        int slot = (relay_next_slot + n) % SCANNER_STUB_MAX_KEYBOARDS;
+        struct zmk_status_adv_data data;
+        uint8_t hops;
+        uint32_t age_ms;
+
+        if (!scanner_get_keyboard_relay_info(slot, &data, &hops, &age_ms) ||
+            hops >= CONFIG_PROSPECTOR_RELAY_MAX_HOPS ||
+            age_ms > CONFIG_PROSPECTOR_RELAY_MAX_AGE_MS) {
+            continue;
+        }
+
+        relay_payload.hop_count = hops + 1;
+        relay_payload.age_ds = MIN(age_ms / 100U, UINT8_MAX);
+        memcpy(relay_payload.keyboard_id, data.keyboard_id, sizeof(relay_payload.keyboard_id));
+        relay_payload.battery_level = data.battery_level;
+        memcpy(relay_payload.peripheral_battery, data.peripheral_battery,
+               sizeof(relay_payload.peripheral_battery));
+        relay_payload.active_layer = data.active_layer;
+        relay_payload.profile_slot = data.profile_slot;
+        relay_payload.status_flags = data.status_flags;
+        relay_payload.modifier_flags = data.modifier_flags;
+        relay_payload.wpm_value = data.wpm_value;
+        relay_payload.channel = data.channel;
+        relay_payload.device_role = data.device_role;
+
+        relay_next_slot = (slot + 1) % SCANNER_STUB_MAX_KEYBOARDS;
+        return true;
+    }
+    return false;
+}
+
+/* Created on first use: BT is enabled asynchronously after SYS_INIT */
+static int relay_create_adv_set(void) {
+    static const struct bt_le_adv_param relay_param = BT_LE_ADV_PARAM_INIT(
+        BT_LE_ADV_OPT_NONE,
+        BT_GAP_MS_TO_ADV_INTERVAL(RELAY_INTERVAL_MS),
+        BT_GAP_MS_TO_ADV_INTERVAL(RELAY_INTERVAL_MS),
+        NULL);
+
+    int err = bt_le_ext_adv_create(&relay_param, NULL, &relay_adv);
+    if (err) {
+        LOG_WRN("Relay advertising set create failed: %d", err);
+        relay_adv = NULL;
+    }
+    return err;
+}
+
+static void relay_work_handler(struct k_work *work) {
+    ARG_UNUSED(work);
+
+    if (!relay_adv && relay_create_adv_set() != 0) {
+        k_work_schedule(&relay_work, K_SECONDS(1));
+        return;
+    }
+
+    if (!relay_pick_next()) {
+        if (relay_advertising) {
+            bt_le_ext_adv_stop(relay_adv);
+            relay_advertising = false;
+            LOG_INF("Relay idle - nothing to re-advertise");
+        }
+        k_work_schedule(&relay_work, K_MSEC(RELAY_INTERVAL_MS));
+        return;
+    }
+
+    int err = bt_le_ext_adv_set_data(relay_adv, relay_ad, ARRAY_SIZE(relay_ad), NULL, 0);
+    if (err) {
+        LOG_WRN("Relay set_data failed: %d", err);
+    } else {
+        relay_stats.tx_updates++;
+        if (!relay_advertising) {
+            err = bt_le_ext_adv_start(relay_adv, BT_LE_EXT_ADV_START_DEFAULT);
+            if (err == 0 || err == -EALREADY) {
+                relay_advertising = true;
+                LOG_INF("Relay advertising started (%u ms interval)", RELAY_INTERVAL_MS);
+            } else {
+                LOG_WRN("Relay advertising start failed: %d", err);
+            }
+        }
+    }
+
+    /* One payload per advertising interval keeps TX within the budget */
+    k_work_schedule(&relay_work, K_MSEC(RELAY_INTERVAL_MS));
+}
+
+static int relay_init(void) {
+    relay_id = sys_rand32_get() & 0xFFFF;
+    sys_put_be16(relay_id, relay_payload.relay_id);
+
+    relay_stats.interval_ms = RELAY_INTERVAL_MS;
+    /* Give the scanner (started once BT is ready) time to fill the table */
+    k_work_schedule(&relay_work, K_SECONDS(2));
+    LOG_INF("Relay mode: id=%04X, interval=%u ms, max hops=%d",
+            relay_id, RELAY_INTERVAL_MS, CONFIG_PROSPECTOR_RELAY_MAX_HOPS);
+    return 0;
+}
+
+void zmk_status_relay_get_stats(struct zmk_status_relay_stats *stats) {
+    *stats = relay_stats;
+    stats->advertising = relay_advertising;
+}
+
+SYS_INIT(relay_init, APPLICATION, 99);
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SHELL)
+
+static int cmd_relay(const struct shell *sh, size_t argc, char **argv) {
+    ARG_UNUSED(argc);
+    ARG_UNUSED(argv);
+
+    struct zmk_status_relay_stats rs;
+    struct scanner_relay_stats ss;
+
+    zmk_status_relay_get_stats(&rs);
+    scanner_get_relay_stats(&ss);
+
+    shell_print(sh, "Relay id=%04X: %s, interval=%u ms (budget %d/1000 airtime)",
+                relay_id, rs.advertising ? "advertising" : "idle", rs.interval_ms,
+                CONFIG_PROSPECTOR_RELAY_AIRTIME_PERMILLE);
+    shell_print(sh, "TX: updates=%u", rs.tx_updates);
+    shell_print(sh, "RX: packets=%u own=%u too_old=%u accepted=%u shadowed_by_direct=%u stale=%u",
+                rs.rx_packets, rs.rx_own, rs.rx_too_old, ss.accepted, ss.ignored_direct,
+                ss.ignored_stale);
+    return 0;
+}
+
+SHELL_SUBCMD_ADD((prospector), relay, NULL, "Relay mode state and counters", cmd_relay, 1, 0);
+
+#endif /* CONFIG_PROSPECTOR_SHELL */
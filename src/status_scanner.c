@@ -15,9 +15,14 @@
 #include <zmk/status_scanner.h>
 #include <zmk/status_advertisement.h>
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_RELAY)
+#include <zmk/status_relay.h>
+#endif
+
 // Scanner stub functions for thread-safe display updates
 // Include path assumes build from zmk-config-prospector
 #include "../boards/shields/prospector_scanner/src/scanner_stub.h"
+#include "../boards/shields/prospector_scanner/src/boot_timing.h"
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
@@ -35,6 +40,25 @@ static zmk_status_scanner_callback_t event_callback = NULL;
 static bool scanning = false;
 static struct k_work_delayable timeout_work;
 
+// Radio diagnostics counters (read via zmk_status_scanner_get_radio_stats)
+static uint32_t scan_count = 0;
+static uint32_t prospector_count = 0;
+static uint32_t channel_filtered_count = 0;
+static uint32_t last_prospector_rx = 0;
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+// Scan-stall watchdog: restarts scanning when no advertising report of any
+// kind arrives for CONFIG_PROSPECTOR_SCAN_WATCHDOG_TIMEOUT_MS
+#define WATCHDOG_CHECK_MS 1000
+static struct k_work_delayable watchdog_work;
+static struct zmk_status_scanner_watchdog_stats wd_stats;
+static uint32_t wd_last_scan_count = 0;
+static uint32_t wd_last_progress = 0;   // Uptime of last observed report
+static uint32_t wd_stall_start = 0;     // Uptime the current stall was detected, 0 = none
+static uint32_t wd_backoff_ms = 0;      // Wait after a restart before the next one
+static uint32_t wd_next_restart = 0;
+#endif
+
 // Mutex for thread-safe access to keyboards array
 // Protects against concurrent access from BLE scan callback, timeout handler, and API calls
 static struct k_mutex scanner_mutex;
@@ -399,14 +423,38 @@ static const char* get_device_name(const bt_addr_le_t *addr) {
     return "Unknown";
 }
 
+// Channel filtering logic - use runtime channel
+// scanner_get_runtime_channel() is provided by system_settings_widget.c
+// Fallback to Kconfig if settings widget not linked
+static uint8_t get_scanner_channel(void) {
+    extern uint8_t scanner_get_runtime_channel(void) __attribute__((weak));
+    uint8_t scanner_channel = 0;
+    if (scanner_get_runtime_channel) {
+        scanner_channel = scanner_get_runtime_channel();
+    }
+#ifdef CONFIG_PROSPECTOR_SCANNER_CHANNEL
+    else {
+        scanner_channel = CONFIG_PROSPECTOR_SCANNER_CHANNEL;
+    }
+#endif
+    return scanner_channel;
+}
+
+// Accept if:
+// - Scanner channel is 0 (accept all)
+// - Keyboard channel is 0 (broadcast to all)
+// - Channels match
+static bool channel_matches(uint8_t scanner_channel, uint8_t keyboard_channel) {
+    return scanner_channel == 0 || keyboard_channel == 0 || scanner_channel == keyboard_channel;
+}
+
 static void scan_callback(const bt_addr_le_t *addr, int8_t rssi, uint8_t type,
                          struct net_buf_simple *buf) {
-    static int scan_count = 0;
     scan_count++;
     
     // Log every 100th scan to avoid spam (or use LOG_DBG for detailed debugging)
     if (scan_count % 100 == 1) {
-        LOG_INF("BLE scan #%d (RSSI: %d)", scan_count, rssi);
+        LOG_INF("BLE scan #%u (RSSI: %d)", scan_count, rssi);
     }
     
     if (!scanning) {
@@ -460,38 +508,36 @@ static void scan_callback(const bt_addr_le_t *addr, int8_t rssi, uint8_t type,
 
                     LOG_DBG("Prospector data found - Length: %d", len);
 
-                    // Channel filtering logic - use runtime channel
-                    // scanner_get_runtime_channel() is provided by system_settings_widget.c
-                    // Fallback to Kconfig if settings widget not linked
-                    extern uint8_t scanner_get_runtime_channel(void) __attribute__((weak));
-                    uint8_t scanner_channel = 0;
-                    if (scanner_get_runtime_channel) {
-                        scanner_channel = scanner_get_runtime_channel();
-                    }
-#ifdef CONFIG_PROSPECTOR_SCANNER_CHANNEL
-                    else {
-                        scanner_channel = CONFIG_PROSPECTOR_SCANNER_CHANNEL;
-                    }
-#endif
+                    uint8_t scanner_channel = get_scanner_channel();
                     uint8_t keyboard_channel = data->channel;
 
-                    // Accept if:
-                    // - Scanner channel is 0 (accept all)
-                    // - Keyboard channel is 0 (broadcast to all)
-                    // - Channels match
-                    bool channel_match = (scanner_channel == 0 ||
-                                        keyboard_channel == 0 ||
-                                        scanner_channel == keyboard_channel);
-
-                    if (channel_match) {
+                    if (channel_matches(scanner_channel, keyboard_channel)) {
                         prospector_data = data;
                         LOG_DBG("Valid Prospector data: Ch:%d->%d Ver=%d Bat=%d%%",
                                keyboard_channel, scanner_channel, data->version, data->battery_level);
                     } else {
+                        channel_filtered_count++;
                         printk("*** SCANNER: Channel mismatch - KB Ch:%d, Scanner Ch:%d (filtered) ***\n",
                                keyboard_channel, scanner_channel);
                     }
-                } else {
+                }
+#if IS_ENABLED(CONFIG_PROSPECTOR_RELAY)
+                // Relayed keyboard from another scanner: FF FF AB CE
+                else if (data->manufacturer_id[0] == 0xFF && data->manufacturer_id[1] == 0xFF &&
+                         data->service_uuid[0] == 0xAB &&
+                         data->service_uuid[1] == ZMK_STATUS_RELAY_UUID_1 &&
+                         len >= sizeof(struct zmk_status_relay_data)) {
+                    const struct zmk_status_relay_data *relay =
+                        (const struct zmk_status_relay_data *)buf_copy.data;
+
+                    if (channel_matches(get_scanner_channel(), relay->channel)) {
+                        zmk_status_relay_handle_rx(relay, rssi);
+                    } else {
+                        channel_filtered_count++;
+                    }
+                }
+#endif
+                else {
                     // Silently ignore non-Prospector devices to reduce log spam
                     LOG_DBG("Non-Prospector device: %02X%02X %02X%02X",
                            data->manufacturer_id[0], data->manufacturer_id[1],
@@ -508,6 +554,10 @@ static void scan_callback(const bt_addr_le_t *addr, int8_t rssi, uint8_t type,
     
     // Process Prospector data if found
     if (prospector_data) {
+        prospector_count++;
+        last_prospector_rx = k_uptime_get_32();
+        boot_timing_mark(BOOT_PHASE_FIRST_PACKET);
+
         LOG_DBG("Central=%d%%, Peripheral=[%d,%d,%d], Layer=%d",
                prospector_data->battery_level, prospector_data->peripheral_battery[0],
                prospector_data->peripheral_battery[1], prospector_data->peripheral_battery[2],
@@ -597,25 +647,89 @@ int zmk_status_scanner_init(void) {
 
     memset(keyboards, 0, sizeof(keyboards));
     k_work_init_delayable(&timeout_work, timeout_work_handler);
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+    k_work_init_delayable(&watchdog_work, watchdog_work_handler);
+#endif
 
     LOG_INF("Status scanner initialized with mutex protection");
     return 0;
 }
 
+// Use 100% duty cycle for immediate response (USB powered, no battery concern)
+// interval = window = 30ms means continuous scanning with no gaps
+static const struct bt_le_scan_param scan_param = {
+    .type = BT_LE_SCAN_TYPE_ACTIVE,  // ACTIVE to receive Scan Response packets
+    .options = BT_LE_SCAN_OPT_NONE,
+    .interval = BT_GAP_SCAN_FAST_WINDOW,  // 30ms (was 60ms)
+    .window = BT_GAP_SCAN_FAST_WINDOW,    // 30ms (100% duty cycle)
+};
+
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+
+static void watchdog_restart_scan(uint32_t now) {
+    wd_stats.restarts++;
+
+    // Controller may already have dropped the scan (-EALREADY is fine)
+    bt_le_scan_stop();
+    int err = bt_le_scan_start(&scan_param, scan_callback);
+    if (err) {
+        wd_stats.restart_errors++;
+        LOG_WRN("Scan watchdog: restart failed (%d), retry in %ums", err, wd_backoff_ms);
+    } else {
+        LOG_WRN("Scan watchdog: no reports for %ums, scan restarted (retry in %ums)",
+                now - wd_last_progress, wd_backoff_ms);
+    }
+
+    wd_next_restart = now + wd_backoff_ms;
+    wd_backoff_ms = MIN(wd_backoff_ms * 2, CONFIG_PROSPECTOR_SCAN_WATCHDOG_MAX_BACKOFF_MS);
+}
+
+static void watchdog_work_handler(struct k_work *work) {
+    if (!scanning) {
+        return;  // Restarted by zmk_status_scanner_start()
+    }
+
+    uint32_t now = k_uptime_get_32();
+    uint32_t count = scan_count;
+
+    if (count != wd_last_scan_count) {
+        wd_last_scan_count = count;
+        wd_last_progress = now;
+        if (wd_stall_start != 0) {
+            // Reports flowing again - time from detection to first report
+            uint32_t recovery = now - wd_stall_start;
+            wd_stats.recoveries++;
+            wd_stats.last_recovery_ms = recovery;
+            wd_stats.max_recovery_ms = MAX(wd_stats.max_recovery_ms, recovery);
+            wd_stall_start = 0;
+            LOG_INF("Scan watchdog: reception recovered after %ums", recovery);
+        }
+    } else if (wd_stall_start == 0) {
+        if (now - wd_last_progress >= CONFIG_PROSPECTOR_SCAN_WATCHDOG_TIMEOUT_MS) {
+            wd_stall_start = now;
+            wd_stats.stalls++;
+            wd_backoff_ms = CONFIG_PROSPECTOR_SCAN_WATCHDOG_TIMEOUT_MS;
+            watchdog_restart_scan(now);
+        }
+    } else if ((int32_t)(now - wd_next_restart) >= 0) {
+        watchdog_restart_scan(now);
+    }
+
+    k_work_schedule(&watchdog_work, K_MSEC(WATCHDOG_CHECK_MS));
+}
+
+void zmk_status_scanner_get_watchdog_stats(struct zmk_status_scanner_watchdog_stats *stats) {
+    *stats = wd_stats;
+    stats->stalled = (wd_stall_start != 0);
+}
+
+#endif // CONFIG_PROSPECTOR_SCAN_WATCHDOG
+
 int zmk_status_scanner_start(void) {
     if (scanning) {
         return 0;
     }
-    
-    // Use 100% duty cycle for immediate response (USB powered, no battery concern)
-    // interval = window = 30ms means continuous scanning with no gaps
-    struct bt_le_scan_param scan_param = {
-        .type = BT_LE_SCAN_TYPE_ACTIVE,  // ACTIVE to receive Scan Response packets
-        .options = BT_LE_SCAN_OPT_NONE,
-        .interval = BT_GAP_SCAN_FAST_WINDOW,  // 30ms (was 60ms)
-        .window = BT_GAP_SCAN_FAST_WINDOW,    // 30ms (100% duty cycle)
-    };
-    
+
     int err = bt_le_scan_start(&scan_param, scan_callback);
     if (err) {
         LOG_ERR("Failed to start scanning: %d", err);
@@ -624,6 +738,13 @@ int zmk_status_scanner_start(void) {
     
     scanning = true;
 
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+    wd_last_scan_count = scan_count;
+    wd_last_progress = k_uptime_get_32();
+    wd_stall_start = 0;
+    k_work_schedule(&watchdog_work, K_MSEC(WATCHDOG_CHECK_MS));
+#endif
+
     // Only schedule timeout work if timeout is enabled (non-zero)
     if (KEYBOARD_TIMEOUT_MS > 0) {
         k_work_schedule(&timeout_work, K_MSEC(KEYBOARD_TIMEOUT_MS / 2));
@@ -643,6 +764,9 @@ int zmk_status_scanner_stop(void) {
     
     scanning = false;
     k_work_cancel_delayable(&timeout_work);
+#if IS_ENABLED(CONFIG_PROSPECTOR_SCAN_WATCHDOG)
+    k_work_cancel_delayable(&watchdog_work);
+#endif
     
     int err = bt_le_scan_stop();
     if (err) {
@@ -708,6 +832,15 @@ int zmk_status_scanner_get_primary_keyboard(void) {
     return primary;
 }
 
+void zmk_status_scanner_get_radio_stats(struct zmk_status_scanner_radio_stats *stats) {
+    stats->scanning = scanning;
+    stats->scan_callbacks = scan_count;
+    stats->prospector_packets = prospector_count;
+    stats->channel_filtered = channel_filtered_count;
+    stats->last_rx_time = last_prospector_rx;
+    stats->channel = get_scanner_channel();
+}
+
 // Initialize on system startup - use later priority to ensure BT is ready
 SYS_INIT(zmk_status_scanner_init, APPLICATION, 99);
 